@@ -0,0 +1,234 @@
+/**
+ * @file calendar.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the Calendar class.
+ * @version 1.0
+ * @date 2024-10-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/additional/calendar.h"
+
+#include "include/additional/date_range.h"
+#include "include/additional/holiday_calendar.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief The number of indexed months.
+constexpr std::size_t kIndexMonths{
+    (Calendar::kLastYear - Calendar::kFirstYear + 1) * Date::kYearMonths};
+
+/// @brief The index of the first indexed month counted from year 0.
+constexpr std::size_t kFirstIndex{Calendar::kFirstYear * Date::kYearMonths};
+
+/**
+ * @brief Builds the serial numbers of the first days of the indexed months.
+ * @return The month starts with the start of the month after the last one.
+ */
+constexpr std::array<Date::DaySerial, kIndexMonths + 1> makeMonthStarts() {
+  std::array<Date::DaySerial, kIndexMonths + 1> starts{};
+  Date date{1, 1, Calendar::kFirstYear};
+
+  for (std::size_t i{}; i <= kIndexMonths; ++i) {
+    starts[i] = date.serial();
+    date.addCreditMonth(1);
+  }
+
+  return starts;
+}
+
+/// @brief The serial numbers of the first days of the indexed months.
+constexpr std::array<Date::DaySerial, kIndexMonths + 1> kMonthStarts{
+    makeMonthStarts()};
+
+}  // namespace
+
+/**
+ * @brief Returns the serial number of the first day of the month.
+ * @param month The month of the year.
+ * @param year The year.
+ * @return The number of days since 01.01.1970.
+ */
+Date::DaySerial Calendar::monthStart(Date::DateSize month,
+                                     Date::DateSize year) noexcept {
+  return monthStart(year * std::size_t{Date::kYearMonths} + month - 1);
+}
+
+/**
+ * @brief Returns the serial number of the first day of the month.
+ * @param index The month counted from January of year 0.
+ * @return The number of days since 01.01.1970.
+ */
+Date::DaySerial Calendar::monthStart(std::size_t index) noexcept {
+  if (index >= kFirstIndex && index - kFirstIndex <= kIndexMonths) {
+    return kMonthStarts[index - kFirstIndex];
+  }
+
+  return Date{1, static_cast<Date::DateSize>(index % Date::kYearMonths + 1),
+              static_cast<Date::DateSize>(index / Date::kYearMonths)}
+      .serial();
+}
+
+/**
+ * @brief Returns the month index of the date.
+ * @param date The date.
+ * @return The month counted from January of year 0.
+ */
+std::size_t Calendar::monthIndex(const Date &date) noexcept {
+  return date.year() * std::size_t{Date::kYearMonths} + date.month() - 1;
+}
+
+/**
+ * @brief Converts the serial day number to a date.
+ *
+ * Inside the indexed years the month is estimated from the mean month length
+ * and corrected by the month start table.
+ * @param serial The number of days since 01.01.1970.
+ * @return The Date object.
+ */
+Date Calendar::toDate(Date::DaySerial serial) noexcept {
+  if (serial < kMonthStarts.front() || serial >= kMonthStarts.back()) {
+    return Date::fromSerial(serial);
+  }
+
+  const std::size_t kEraDays = 146097;
+  const std::size_t kEraMonths = 4800;
+  std::size_t i{(serial - kMonthStarts.front()) * kEraMonths / kEraDays};
+
+  i = std::min(i, kIndexMonths - 1);
+
+  while (kMonthStarts[i + 1] <= serial) ++i;
+  while (kMonthStarts[i] > serial) --i;
+
+  return Date{static_cast<Date::DateSize>(serial - kMonthStarts[i] + 1),
+              static_cast<Date::DateSize>(i % Date::kYearMonths + 1),
+              static_cast<Date::DateSize>(kFirstYear + i / Date::kYearMonths)};
+}
+
+/**
+ * @brief Adds months keeping the day, or the last day of a shorter month.
+ * @param date The initial date.
+ * @param months The number of months to add.
+ * @param day The day of the month to keep.
+ * @return The shifted date.
+ */
+Date Calendar::addMonths(const Date &date, std::size_t months,
+                         Date::DateSize day) noexcept {
+  std::size_t index{monthIndex(date) + months};
+  Date::DaySerial start{monthStart(index)};
+  Date::DateSize days{
+      static_cast<Date::DateSize>(monthStart(index + 1) - start)};
+
+  return Date{std::min(day, days),
+              static_cast<Date::DateSize>(index % Date::kYearMonths + 1),
+              static_cast<Date::DateSize>(index / Date::kYearMonths)};
+}
+
+/**
+ * @brief Appends the next monthly credit payment dates.
+ * @param start The start date of the credit.
+ * @param count The number of dates to append.
+ * @param dates The dates generated so far.
+ * @param holidays The calendar to shift the dates to business days, if any.
+ */
+void Calendar::creditSchedule(const Date &start, std::size_t count,
+                              std::pmr::vector<Date> &dates,
+                              const HolidayCalendar *holidays) {
+  std::size_t first{dates.size() + 1};
+
+  dates.reserve(dates.size() + count);
+
+  for (std::size_t i{first}; i < first + count; ++i) {
+    Date date{addMonths(start, i, start.day())};
+    dates.push_back(holidays ? holidays->nextBusinessDay(date) : date);
+  }
+}
+
+/**
+ * @brief Generates the deposit payment dates up to the last day.
+ *
+ * Every period starts from the previous nominal payment date. Day periods
+ * step over a DateRange of the period starts, month periods add the lengths
+ * of the months they cover, zero periods pay at the last day only. Shifted
+ * dates are not chained, and periods shifted onto the same business day are
+ * merged. The dates are reserved once, for month periods by the count of
+ * the shortest months.
+ * @param start The start date of the deposit.
+ * @param last The last day of the deposit.
+ * @param days The length of a period in days.
+ * @param months The length of a period in months.
+ * @param holidays The calendar to shift the dates to business days, if any.
+ * @param resource The memory resource of the dates.
+ * @return The payment dates with the last day at the end.
+ */
+std::pmr::vector<Date> Calendar::depositSchedule(
+    const Date &start, const Date &last, std::size_t days, std::size_t months,
+    const HolidayCalendar *holidays, std::pmr::memory_resource *resource) {
+  std::pmr::vector<Date> dates{resource};
+  Date::DaySerial serial{start.serial()};
+  Date::DaySerial end{last.serial()};
+  Date::DaySerial paid{serial};
+
+  if (!months && days) {
+    DateRange periods{start, last, days};
+    dates.reserve(periods.size());
+
+    for (Date period : periods) {
+      addPayment(std::min(period.serial() + static_cast<Date::DaySerial>(days),
+                          end),
+                 paid, holidays, dates);
+    }
+  } else {
+    const std::size_t kMonthDays = 28;
+    std::size_t index{monthIndex(start)};
+    std::size_t periods{1};
+
+    if (months && serial < end) {
+      periods += static_cast<std::size_t>(end - serial) / (kMonthDays * months);
+    }
+
+    dates.reserve(periods);
+
+    while (serial < end) {
+      if (months) {
+        serial += monthStart(index + months) - monthStart(index);
+        serial = std::min(serial, end);
+        index = monthIndex(toDate(serial));
+      } else {
+        serial = end;
+      }
+
+      addPayment(serial, paid, holidays, dates);
+    }
+  }
+
+  return dates;
+}
+
+/**
+ * @brief Appends a payment date shifted to a business day.
+ * @param serial The serial number of the nominal payment date.
+ * @param paid The last business day paid on, updated by the call.
+ * @param holidays The calendar to shift the date to a business day, if any.
+ * @param dates The payment dates.
+ */
+void Calendar::addPayment(Date::DaySerial serial, Date::DaySerial &paid,
+                          const HolidayCalendar *holidays,
+                          std::pmr::vector<Date> &dates) {
+  if (holidays) {
+    Date::DaySerial business{holidays->nextBusinessDay(serial)};
+
+    if (business == paid) return;
+
+    paid = business;
+    serial = business;
+  }
+
+  dates.push_back(toDate(serial));
+}
+
+}  // namespace s21
@@ -0,0 +1,189 @@
+/**
+ * @file holiday_calendar.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the HolidayCalendar class.
+ * @version 1.0
+ * @date 2024-10-10
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/additional/holiday_calendar.h"
+
+namespace s21 {
+
+/**
+ * @brief Constructs a HolidayCalendar object with weekends only.
+ * @param first_year The first indexed year.
+ * @param last_year The last indexed year.
+ */
+HolidayCalendar::HolidayCalendar(Date::DateSize first_year,
+                                 Date::DateSize last_year)
+    : first_{Date{1, 1, first_year}.serial()},
+      last_{Date{1, 1, static_cast<Date::DateSize>(last_year + 1)}.serial()} {
+  clear();
+}
+
+/**
+ * @brief Loads the holidays from a text file.
+ *
+ * Every line holds one date in the format "DD.MM.YYYY" or "YYYY-MM-DD".
+ * Empty lines and lines starting with '#' are skipped.
+ * @param path The path to the file.
+ * @throws std::invalid_argument if the file cannot be read or a line is not
+ * a valid date.
+ */
+void HolidayCalendar::load(const std::string &path) {
+  const char *kSpaces = " \t\r";
+  std::ifstream file{path};
+  std::string line;
+
+  if (!file.is_open()) {
+    throw std::invalid_argument("HolidayCalendar:: cannot open " + path);
+  }
+
+  while (std::getline(file, line)) {
+    std::string_view text{line};
+    std::size_t first{text.find_first_not_of(kSpaces)};
+
+    if (first == std::string_view::npos || text[first] == '#') continue;
+
+    text = text.substr(first, text.find_last_not_of(kSpaces) - first + 1);
+    Date date;
+
+    if (Date::parse(text, date) != Date::ParseResult::PARSE_OK) {
+      throw std::invalid_argument("HolidayCalendar:: invalid line " + line);
+    }
+
+    addHoliday(date);
+  }
+}
+
+/**
+ * @brief Marks the date as a non-business day.
+ * @param date The holiday. Dates outside the indexed years are ignored.
+ */
+void HolidayCalendar::addHoliday(const Date &date) noexcept {
+  Date::DaySerial serial{date.serial()};
+
+  if (serial >= first_ && serial < last_) {
+    std::size_t pos = serial - first_;
+    closed_[pos / kWordBits] |= std::uint64_t{1} << (pos % kWordBits);
+  }
+}
+
+/// @brief Removes all holidays keeping the weekends.
+void HolidayCalendar::clear() noexcept {
+  closed_.assign((last_ - first_ + kWordBits - 1) / kWordBits, 0);
+
+  for (Date::DaySerial serial{first_}; serial < last_; ++serial) {
+    if (isWeekend(serial)) {
+      std::size_t pos = serial - first_;
+      closed_[pos / kWordBits] |= std::uint64_t{1} << (pos % kWordBits);
+    }
+  }
+}
+
+/**
+ * @brief Checks whether the day is neither a weekend nor a holiday.
+ * @param serial The number of days since 01.01.1970.
+ * @return True if the day is a business day.
+ */
+bool HolidayCalendar::isBusinessDay(Date::DaySerial serial) const noexcept {
+  if (serial < first_ || serial >= last_) return !isWeekend(serial);
+
+  std::size_t pos = serial - first_;
+
+  return !((closed_[pos / kWordBits] >> (pos % kWordBits)) & 1);
+}
+
+/**
+ * @brief Checks whether the date is neither a weekend nor a holiday.
+ * @param date The date.
+ * @return True if the date is a business day.
+ */
+bool HolidayCalendar::isBusinessDay(const Date &date) const noexcept {
+  return isBusinessDay(date.serial());
+}
+
+/**
+ * @brief Returns the day itself or the first business day after it.
+ *
+ * Inside the indexed years whole words of the bitset are skipped at once.
+ * @param serial The number of days since 01.01.1970.
+ * @return The serial number of the business day.
+ */
+Date::DaySerial HolidayCalendar::nextBusinessDay(
+    Date::DaySerial serial) const noexcept {
+  while (serial < first_ && isWeekend(serial)) ++serial;
+
+  if (serial >= first_ && serial < last_) {
+    std::size_t pos = serial - first_;
+    std::size_t word{pos / kWordBits};
+    std::uint64_t open{~closed_[word] &
+                       (~std::uint64_t{} << (pos % kWordBits))};
+
+    while (!open && ++word < closed_.size()) {
+      open = ~closed_[word];
+    }
+
+    serial = (open) ? first_ + static_cast<Date::DaySerial>(
+                                   word * kWordBits + lowestBit(open))
+                    : last_;
+  }
+
+  if (serial >= last_) {
+    while (isWeekend(serial)) ++serial;
+  }
+
+  return serial;
+}
+
+/**
+ * @brief Returns the date itself or the first business day after it.
+ * @param date The date.
+ * @return The business day.
+ */
+Date HolidayCalendar::nextBusinessDay(const Date &date) const noexcept {
+  Date::DaySerial serial{date.serial()};
+  Date::DaySerial business{nextBusinessDay(serial)};
+
+  return (business == serial) ? date : Calendar::toDate(business);
+}
+
+/**
+ * @brief Checks whether the day is Saturday or Sunday.
+ * @param serial The number of days since 01.01.1970, which was Thursday.
+ * @return True if the day is a weekend.
+ */
+bool HolidayCalendar::isWeekend(Date::DaySerial serial) noexcept {
+  const Date::DaySerial kWeekDays = 7;
+  const Date::DaySerial kThursday = 3;
+  const Date::DaySerial kSaturday = 5;
+
+  return ((serial % kWeekDays + kWeekDays + kThursday) % kWeekDays) >=
+         kSaturday;
+}
+
+/**
+ * @brief Returns the index of the lowest set bit.
+ * @param word The bitset word, not zero.
+ * @return The number of trailing zero bits.
+ */
+std::size_t HolidayCalendar::lowestBit(std::uint64_t word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t bit{};
+
+  while (!(word & 1U)) {
+    word >>= 1;
+    ++bit;
+  }
+
+  return bit;
+#endif
+}
+
+}  // namespace s21
@@ -18,6 +18,14 @@ Plot::Plot() : BaseWindow{} {
   initView();
 }
 
+Plot::~Plot() {
+  cancel();
+
+  for (std::future<void> &worker : workers_) {
+    worker.wait();
+  }
+}
+
 void Plot::allocateMemory() {
   plot_ = new QCustomPlot{};
   settings_ = new QGridLayout{};
@@ -67,6 +75,8 @@ void Plot::initView() {
   plot_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
   plot_->setInteraction(QCP::iRangeZoom, true);
   plot_->setInteraction(QCP::iRangeDrag, true);
+  connect(plot_->xAxis, qOverload<const QCPRange &>(&QCPAxis::rangeChanged),
+          this, &Plot::onRangeChanged);
 
   BaseWindow::main_layout_->addWidget(plot_);
   settings_->addWidget(lbegin_, 0, 1, 1, 1, Qt::AlignCenter);
@@ -113,6 +123,7 @@ void Plot::initView() {
 }
 
 void Plot::closeEvent(QCloseEvent *event) {
+  cancel();
   emit windowClosed();
   event->accept();
 }
@@ -138,38 +149,130 @@ bool Plot::isValidAll() noexcept {
 void Plot::build(CalculatorController *controller) {
   if (!isValidAll()) return;
 
+  cancel();
+  controller_ = controller;
+  program_ = controller->compiled();
+  min_step_ = step_->text().toDouble();
+  cache_.clear();
+  ++revision_;
+
   plot_->clearItems();
-  long double prev{controller->evaluate_num()};
-  long double result{}, diff{};
-  QVector<double> x, y;
-
-  long double step_val = step_->text().toDouble();
-  long double x_begin = xbegin_->text().toDouble();
-  long double x_end = xend_->text().toDouble();
-  long double y_begin = ybegin_->text().toDouble();
-  long double y_end = yend_->text().toDouble();
-
-  plot_->xAxis->setRange(x_begin, x_end);
-  plot_->yAxis->setRange(y_begin, y_end);
-
-  for (long double i = x_begin; i <= x_end; i += step_val) {
-    controller->variable() = i;
-    result = controller->evaluate_num();
-    diff = std::fabs(result - prev);
-    x.push_back(i);
-
-    if (result < y_end && result > y_begin && diff < 200) {
-      y.push_back(result);
-    } else {
-      y.push_back(std::nan(""));
+
+  if (!plot_->graphCount()) {
+    plot_->addGraph(plot_->xAxis, plot_->yAxis)
+        ->setPen(QPen{QColor(255, 0, 0)});
+  }
+
+  {
+    const QSignalBlocker blocker{plot_->xAxis};
+    plot_->xAxis->setRange(xbegin_->text().toDouble(),
+                           xend_->text().toDouble());
+    plot_->yAxis->setRange(ybegin_->text().toDouble(),
+                           yend_->text().toDouble());
+  }
+
+  resample();
+}
+
+void Plot::cancel() {
+  ++generation_;
+
+  workers_.erase(std::remove_if(workers_.begin(), workers_.end(),
+                                [](const std::future<void> &worker) {
+                                  return worker.wait_for(
+                                             std::chrono::seconds{0}) ==
+                                         std::future_status::ready;
+                                }),
+                 workers_.end());
+}
+
+void Plot::resample() {
+  cancel();
+
+  QCPRange x_range{plot_->xAxis->range()}, y_range{plot_->yAxis->range()};
+  level_ = SegmentCache::level(x_range.size(), plot_->axisRect()->width());
+  refresh();
+
+  Job job{controller_,
+          program_,
+          {0.0, 0.0, y_range.lower, y_range.upper,
+           std::max(min_step_, SegmentCache::resolution(level_) / kSubpixel)},
+          tolerance_,
+          level_,
+          cache_.missing(level_, x_range.lower, x_range.upper),
+          generation_.load(),
+          revision_};
+
+  if (!job.chunks.empty()) {
+    workers_.push_back(
+        std::async(std::launch::async, &Plot::sample, this, std::move(job)));
+  }
+}
+
+void Plot::refresh() {
+  std::vector<double> x, y;
+  QCPRange range{plot_->xAxis->range()};
+
+  cache_.collect(level_, range.lower, range.upper, x, y);
+  plot_->graph(0)->setData(QVector<double>(x.begin(), x.end()),
+                           QVector<double>(y.begin(), y.end()), true);
+  plot_->replot(QCustomPlot::rpQueuedReplot);
+}
+
+void Plot::sample(Job job) {
+  Sampler::Evaluator evaluate{
+      [&job](const double *xs, double *out, std::size_t n) {
+        job.controller->sweep(*job.program, xs, out, n);
+      }};
+  Sampler::Stop stop{[this, &job] { return job.generation != generation_; }};
+  double width{SegmentCache::chunkWidth(job.level)};
+  std::vector<Sampler> samplers;
+  samplers.reserve(job.chunks.size());
+
+  for (long long chunk : job.chunks) {
+    job.range.x_begin = chunk * width;
+    job.range.x_end = job.range.x_begin + width;
+    samplers.emplace_back(job.range, job.tolerance);
+
+    if (!samplers.back().refine(evaluate, stop)) return;
+
+    publish(job, chunk, samplers.back());
+  }
+
+  for (std::size_t i{}; i < samplers.size(); ++i) {
+    while (samplers[i].refine(evaluate, stop)) {
+      publish(job, job.chunks[i], samplers[i]);
     }
 
-    prev = result;
+    if (job.generation != generation_) return;
   }
+}
+
+void Plot::publish(const Job &job, long long chunk, const Sampler &sampler) {
+  QMetaObject::invokeMethod(
+      this,
+      [this, level = job.level, revision = job.revision, chunk,
+       segment = SegmentCache::Segment{sampler.x(), sampler.y()}] {
+        if (revision != revision_) return;
+
+        cache_.insert(level, chunk, segment);
 
-  plot_->addGraph(plot_->xAxis, plot_->yAxis)->setPen(QPen{QColor(255, 0, 0)});
-  plot_->graph(0)->setData(x, y);
-  plot_->replot();
+        if (level == level_) {
+          refresh();
+        }
+      },
+      Qt::QueuedConnection);
+}
+
+void Plot::setTolerance(double tolerance) noexcept {
+  cancel();
+  tolerance_ = tolerance;
+  cache_.clear();
+  ++revision_;
+
+  if (program_) {
+    resample();
+  }
 }
 
 bool Plot::isValidInput(QLineEdit *line) const noexcept {
@@ -200,7 +303,19 @@ void Plot::onTextChanged(const QString &text) {
     isValidInput(line_edit);
   }
 
+  if (controller_ && isVisible()) {
+    build(controller_);
+  }
+
   (void)text;
 }
 
+void Plot::onRangeChanged(const QCPRange &range) {
+  if (program_) {
+    resample();
+  }
+
+  (void)range;
+}
+
 }  // namespace s21
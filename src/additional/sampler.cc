@@ -0,0 +1,216 @@
+/**
+ * @file sampler.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the Sampler class.
+ * @version 1.0
+ * @date 2024-10-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/additional/sampler.h"
+
+namespace s21 {
+
+/**
+ * @brief Constructs a Sampler object.
+ * @param range The sampled range.
+ * @param tolerance The allowed deviation from a straight segment as a part
+ * of the visible height.
+ */
+Sampler::Sampler(const Range &range, double tolerance)
+    : range_{range},
+      tolerance_{tolerance * (range.y_end - range.y_begin)},
+      height_{range.y_end - range.y_begin} {}
+
+/**
+ * @brief Runs the next sampling pass.
+ *
+ * The first pass samples a uniform grid. Every next pass evaluates the
+ * midpoints of the intervals that bend more than the tolerance, cross a
+ * domain boundary or jump, until they get narrower than two steps. The stop
+ * condition is checked between the batches of a pass, and a stopped pass
+ * leaves the graph as it was.
+ * @param evaluate The function to sample.
+ * @param stop The condition to abandon the pass, if any.
+ * @return False if the graph is already refined or the pass was stopped.
+ */
+bool Sampler::refine(const Evaluator &evaluate, const Stop &stop) {
+  std::vector<double> xs;
+
+  if (xs_.empty()) {
+    double width{range_.x_end - range_.x_begin};
+    std::size_t intervals{std::clamp<std::size_t>(
+        static_cast<std::size_t>(width / range_.step), 1, kInitialSamples)};
+
+    for (std::size_t i{}; i <= intervals; ++i) {
+      xs.push_back(range_.x_begin + width * i / intervals);
+    }
+  } else {
+    if (xs_.size() >= kMaxSamples) return false;
+
+    mark();
+
+    for (std::size_t i{}; i < split_.size(); ++i) {
+      if (split_[i]) {
+        xs.push_back((xs_[i] + xs_[i + 1]) / 2);
+      }
+    }
+
+    if (xs.empty()) return false;
+  }
+
+  std::vector<double> ys(xs.size());
+
+  for (std::size_t i{}; i < xs.size(); i += kBatchSamples) {
+    if (stop && stop()) return false;
+
+    evaluate(xs.data() + i, ys.data() + i,
+             std::min(kBatchSamples, xs.size() - i));
+  }
+
+  evaluations_ += xs.size();
+
+  merge(xs, ys);
+  trace();
+
+  return true;
+}
+
+/**
+ * @brief Returns the x values of the graph.
+ * @return The x values in ascending order.
+ */
+const std::vector<double> &Sampler::x() const noexcept { return x_; }
+
+/**
+ * @brief Returns the y values of the graph.
+ * @return The y values with NaN at the discontinuities.
+ */
+const std::vector<double> &Sampler::y() const noexcept { return y_; }
+
+/**
+ * @brief Returns the number of evaluated points.
+ * @return The number of points passed to the evaluator.
+ */
+std::size_t Sampler::evaluations() const noexcept { return evaluations_; }
+
+/// @brief Marks the intervals to split in the next pass.
+void Sampler::mark() {
+  split_.assign(xs_.size() - 1, 0);
+
+  for (std::size_t i{}; i < split_.size(); ++i) {
+    if (canSplit(i) && (std::isnan(ys_[i]) != std::isnan(ys_[i + 1]) ||
+                        isJump(i))) {
+      split_[i] = 1;
+    }
+  }
+
+  for (std::size_t i{1}; i < split_.size(); ++i) {
+    if (isBent(i)) {
+      split_[i - 1] |= canSplit(i - 1);
+      split_[i] |= canSplit(i);
+    }
+  }
+}
+
+/**
+ * @brief Inserts the evaluated midpoints between the sampled points.
+ * @param xs The midpoints of the marked intervals in ascending order.
+ * @param ys The values at the midpoints.
+ */
+void Sampler::merge(const std::vector<double> &xs,
+                    const std::vector<double> &ys) {
+  if (xs_.empty()) {
+    xs_ = xs;
+    ys_ = ys;
+    return;
+  }
+
+  std::vector<double> merged_x, merged_y;
+  merged_x.reserve(xs_.size() + xs.size());
+  merged_y.reserve(ys_.size() + ys.size());
+
+  for (std::size_t i{}, j{}; i < xs_.size(); ++i) {
+    merged_x.push_back(xs_[i]);
+    merged_y.push_back(ys_[i]);
+
+    if (i < split_.size() && split_[i]) {
+      merged_x.push_back(xs[j]);
+      merged_y.push_back(ys[j++]);
+    }
+  }
+
+  xs_.swap(merged_x);
+  ys_.swap(merged_y);
+}
+
+/// @brief Builds the graph breaking it at the jumps that cannot be split.
+void Sampler::trace() {
+  x_.clear();
+  y_.clear();
+
+  for (std::size_t i{}; i < xs_.size(); ++i) {
+    x_.push_back(xs_[i]);
+    y_.push_back(ys_[i]);
+
+    if (i + 1 < xs_.size() && !canSplit(i) && isJump(i)) {
+      x_.push_back((xs_[i] + xs_[i + 1]) / 2);
+      y_.push_back(std::nan(""));
+    }
+  }
+}
+
+/**
+ * @brief Checks whether the interval is at least two steps wide.
+ * @param i The index of the left point of the interval.
+ * @return True if both halves are not narrower than the step.
+ */
+bool Sampler::canSplit(std::size_t i) const noexcept {
+  return xs_[i + 1] - xs_[i] >= 2 * range_.step;
+}
+
+/**
+ * @brief Checks whether the middle point deviates from the chord of its
+ * neighbours more than the tolerance.
+ * @param i The index of the middle point.
+ * @return False if any value is NaN or all of them are off the same edge.
+ */
+bool Sampler::isBent(std::size_t i) const noexcept {
+  double a{ys_[i - 1]}, b{ys_[i]}, c{ys_[i + 1]};
+
+  if (std::isnan(a) || std::isnan(b) || std::isnan(c)) return false;
+  if (isHidden(a, b) && isHidden(b, c)) return false;
+
+  double ratio{(xs_[i] - xs_[i - 1]) / (xs_[i + 1] - xs_[i - 1])};
+
+  return std::fabs(b - (a + (c - a) * ratio)) > tolerance_;
+}
+
+/**
+ * @brief Checks whether the values at the interval ends differ by more than
+ * a half of the visible height.
+ * @param i The index of the left point of the interval.
+ * @return False if any value is NaN or both are off the same edge.
+ */
+bool Sampler::isJump(std::size_t i) const noexcept {
+  double a{ys_[i]}, b{ys_[i + 1]};
+
+  if (std::isnan(a) || std::isnan(b) || isHidden(a, b)) return false;
+
+  return std::fabs(b - a) > kJumpRatio * height_;
+}
+
+/**
+ * @brief Checks whether both values are off the same edge of the view.
+ * @param a The first value.
+ * @param b The second value.
+ * @return True if the segment between the values is not visible.
+ */
+bool Sampler::isHidden(double a, double b) const noexcept {
+  return (a > range_.y_end && b > range_.y_end) ||
+         (a < range_.y_begin && b < range_.y_begin);
+}
+
+}  // namespace s21
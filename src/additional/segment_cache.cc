@@ -0,0 +1,165 @@
+/**
+ * @file segment_cache.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the SegmentCache class.
+ * @version 1.0
+ * @date 2024-10-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/additional/segment_cache.h"
+
+namespace s21 {
+
+/**
+ * @brief Constructs a SegmentCache object.
+ * @param capacity The maximum number of segments.
+ */
+SegmentCache::SegmentCache(std::size_t capacity) : capacity_{capacity} {}
+
+/**
+ * @brief Returns the level whose resolution fits the pixel width.
+ * @param width The visible width in x units.
+ * @param pixels The visible width in pixels.
+ * @return The power of two not larger than the width of one pixel.
+ */
+int SegmentCache::level(double width, int pixels) noexcept {
+  double pixel{width / std::max(pixels, 1)};
+
+  if (!(pixel > 0)) return -kMaxLevel;
+
+  return std::clamp(static_cast<int>(std::floor(std::log2(pixel))), -kMaxLevel,
+                    kMaxLevel);
+}
+
+/**
+ * @brief Returns the distance between the samples of the level.
+ * @param level The resolution level.
+ * @return Two raised to the level.
+ */
+double SegmentCache::resolution(int level) noexcept {
+  return std::ldexp(1.0, level);
+}
+
+/**
+ * @brief Returns the width of one chunk of the level.
+ * @param level The resolution level.
+ * @return The width of kChunkPixels samples.
+ */
+double SegmentCache::chunkWidth(int level) noexcept {
+  return kChunkPixels * resolution(level);
+}
+
+/**
+ * @brief Finds the chunks of the range that are not cached yet.
+ * @param level The resolution level.
+ * @param begin The first visible x value.
+ * @param end The last visible x value.
+ * @return The indices of the missing chunks in ascending order.
+ */
+std::vector<long long> SegmentCache::missing(int level, double begin,
+                                             double end) const {
+  std::vector<long long> result;
+  auto [first, last] = chunks(level, begin, end);
+
+  for (long long chunk{first}; chunk <= last; ++chunk) {
+    if (!segments_.count({level, chunk})) {
+      result.push_back(chunk);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * @brief Stores the sampled chunk.
+ *
+ * Segments of other levels are dropped once the cache is full.
+ * @param level The resolution level.
+ * @param chunk The chunk index.
+ * @param segment The sampled points.
+ */
+void SegmentCache::insert(int level, long long chunk, Segment segment) {
+  if (segments_.size() >= capacity_) {
+    for (auto it{segments_.begin()}; it != segments_.end();) {
+      it = (it->first.first != level) ? segments_.erase(it) : std::next(it);
+    }
+  }
+
+  if (segments_.size() >= capacity_) {
+    segments_.clear();
+  }
+
+  segments_[{level, chunk}] = std::move(segment);
+}
+
+/**
+ * @brief Joins the cached chunks covering the range.
+ * @param level The resolution level.
+ * @param begin The first visible x value.
+ * @param end The last visible x value.
+ * @param x The joined x values.
+ * @param y The joined y values with NaN in place of the missing chunks.
+ */
+void SegmentCache::collect(int level, double begin, double end,
+                           std::vector<double> &x,
+                           std::vector<double> &y) const {
+  auto [first, last] = chunks(level, begin, end);
+  double width{chunkWidth(level)};
+
+  x.clear();
+  y.clear();
+
+  for (long long chunk{first}; chunk <= last; ++chunk) {
+    auto it{segments_.find({level, chunk})};
+
+    if (it == segments_.end()) {
+      x.push_back(chunk * width);
+      y.push_back(std::nan(""));
+    } else {
+      x.insert(x.end(), it->second.x.begin(), it->second.x.end());
+      y.insert(y.end(), it->second.y.begin(), it->second.y.end());
+    }
+  }
+}
+
+/// @brief Removes all segments.
+void SegmentCache::clear() noexcept { segments_.clear(); }
+
+/**
+ * @brief Returns the number of cached segments.
+ * @return The number of segments of all levels.
+ */
+std::size_t SegmentCache::size() const noexcept { return segments_.size(); }
+
+/**
+ * @brief Returns the chunks overlapping the range.
+ *
+ * The indices are clamped to the range of long long, and at most kMaxChunks
+ * chunks from the first one are returned, so a view far wider than the
+ * level allows stays cheap.
+ * @param level The resolution level.
+ * @param begin The first visible x value.
+ * @param end The last visible x value.
+ * @return The first and the last chunk index, the last one is less than the
+ * first one if the range is empty or not a number.
+ */
+std::pair<long long, long long> SegmentCache::chunks(int level, double begin,
+                                                     double end) noexcept {
+  double width{chunkWidth(level)};
+  double first{std::floor(begin / width)}, last{std::floor(end / width)};
+
+  if (!(first <= last)) return {0, -1};
+
+  first = std::clamp(first, -kMaxChunk, kMaxChunk);
+  last = std::clamp(last, first, kMaxChunk);
+
+  long long index{static_cast<long long>(first)};
+
+  return {index,
+          std::min(static_cast<long long>(last), index + kMaxChunks - 1)};
+}
+
+}  // namespace s21
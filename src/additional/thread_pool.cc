@@ -0,0 +1,185 @@
+/**
+ * @file thread_pool.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the ThreadPool class.
+ * @version 1.0
+ * @date 2024-10-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/additional/thread_pool.h"
+
+namespace s21 {
+
+/**
+ * @brief Constructs a ThreadPool object.
+ * @param threads The number of threads including the calling one, 0 to use
+ * the hardware concurrency.
+ */
+ThreadPool::ThreadPool(std::size_t threads) {
+  if (!threads) {
+    threads = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  for (std::size_t i{}; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+
+  for (std::size_t i{1}; i < threads; ++i) {
+    workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+  }
+}
+
+/// @brief Stops and joins the worker threads.
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stop_ = true;
+  }
+
+  start_.notify_all();
+
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+/**
+ * @brief Returns the number of threads running the tasks.
+ * @return The number of workers plus the calling thread.
+ */
+std::size_t ThreadPool::size() const noexcept { return queues_.size(); }
+
+/**
+ * @brief Runs tasks with indices [0, tasks) and waits for all of them.
+ *
+ * Every thread starts with a contiguous block of indices and steals from
+ * the back of other queues once its own queue is empty.
+ * @param tasks The number of tasks.
+ * @param task The task to run for every index.
+ * @throws The first exception thrown by a task.
+ */
+void ThreadPool::parallelFor(std::size_t tasks, const Task &task) {
+  std::lock_guard<std::mutex> job{job_mutex_};
+  std::size_t threads{queues_.size()};
+
+  for (std::size_t i{}; i < threads; ++i) {
+    std::lock_guard<std::mutex> lock{queues_[i]->mutex};
+
+    for (std::size_t j{i * tasks / threads}; j < (i + 1) * tasks / threads;
+         ++j) {
+      queues_[i]->tasks.push_back(j);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    task_ = &task;
+    error_ = nullptr;
+    active_ = workers_.size();
+    ++generation_;
+  }
+
+  start_.notify_all();
+  runTasks(0);
+
+  std::unique_lock<std::mutex> lock{mutex_};
+  done_.wait(lock, [this] { return !active_; });
+  task_ = nullptr;
+
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+}
+
+/**
+ * @brief Waits for jobs and runs their tasks until the pool is stopped.
+ * @param id The index of the worker queue.
+ */
+void ThreadPool::workerLoop(std::size_t id) {
+  std::size_t seen{};
+
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      start_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+
+      if (stop_) return;
+
+      seen = generation_;
+    }
+
+    runTasks(id);
+
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    if (!--active_) {
+      done_.notify_one();
+    }
+  }
+}
+
+/**
+ * @brief Runs own and stolen tasks until no task is left.
+ * @param id The index of the thread queue.
+ */
+void ThreadPool::runTasks(std::size_t id) {
+  std::size_t task;
+
+  while (popTask(id, task) || stealTask(id, task)) {
+    try {
+      (*task_)(task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock{mutex_};
+
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+/**
+ * @brief Takes a task from the front of the own queue.
+ * @param id The index of the thread queue.
+ * @param task The taken task index.
+ * @return False if the queue is empty.
+ */
+bool ThreadPool::popTask(std::size_t id, std::size_t &task) {
+  Queue &queue{*queues_[id]};
+  std::lock_guard<std::mutex> lock{queue.mutex};
+
+  if (queue.tasks.empty()) return false;
+
+  task = queue.tasks.front();
+  queue.tasks.pop_front();
+
+  return true;
+}
+
+/**
+ * @brief Takes a task from the back of another thread queue.
+ * @param id The index of the stealing thread queue.
+ * @param task The taken task index.
+ * @return False if all queues are empty.
+ */
+bool ThreadPool::stealTask(std::size_t id, std::size_t &task) {
+  std::size_t threads{queues_.size()};
+
+  for (std::size_t i{1}; i < threads; ++i) {
+    Queue &queue{*queues_[(id + i) % threads]};
+    std::lock_guard<std::mutex> lock{queue.mutex};
+
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace s21
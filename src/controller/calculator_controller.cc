@@ -25,15 +25,30 @@ CalculatorController::~CalculatorController() { delete model_; }
 
 void CalculatorController::infix_to_postfix(std::string infix,
                                             long double var) noexcept {
-  model_->add_expression(infix, var);
-  model_->to_postfix();
+  compile(infix, var);
 }
 
 bool CalculatorController::validate(std::string infix,
                                     long double var) noexcept {
-  model_->add_expression(infix, var);
+  return compile(infix, var);
+}
+
+bool CalculatorController::compile(const std::string& infix, long double var) {
+  std::string key{ExpressionCache::normalize(infix)};
+  const ExpressionCache::Entry* entry{cache_.find(key)};
+  bool valid;
 
-  return model_->validate();
+  if (entry) {
+    model_->set_program(entry->program, var);
+    valid = entry->valid;
+  } else {
+    model_->add_expression(infix, var);
+    model_->to_postfix();
+    valid = model_->validate();
+    cache_.insert(key, {valid, model_->compiled()});
+  }
+
+  return valid;
 }
 
 long double CalculatorController::evaluate_num() {
@@ -48,6 +63,46 @@ long double CalculatorController::evaluate_num() {
   return result;
 }
 
+void CalculatorController::evaluate_batch(const double* xs, double* out,
+                                          std::size_t n) noexcept {
+  try {
+    model_->evaluate_batch(xs, out, n);
+  } catch (const std::invalid_argument& exception) {
+    std::fill_n(out, n, std::nan(""));
+  }
+}
+
+void CalculatorController::sweep(const double* xs, double* out,
+                                 std::size_t n) noexcept {
+  sweep(*model_->compiled(), xs, out, n);
+}
+
+void CalculatorController::sweep(const CalculatorModel::Program& program,
+                                 const double* xs, double* out,
+                                 std::size_t n) noexcept {
+  std::size_t chunks{n / kSweepChunk};
+
+  try {
+    if (chunks < 2) {
+      program.evaluate_batch(xs, out, n);
+      return;
+    }
+
+    std::call_once(pool_flag_,
+                   [this] { pool_ = std::make_unique<ThreadPool>(); });
+    chunks = std::min(chunks, pool_->size() * kChunksPerThread);
+
+    pool_->parallelFor(chunks, [&program, xs, out, n,
+                                chunks](std::size_t chunk) {
+      std::size_t begin{n * chunk / chunks};
+      program.evaluate_batch(xs + begin, out + begin,
+                             n * (chunk + 1) / chunks - begin);
+    });
+  } catch (...) {
+    std::fill_n(out, n, std::nan(""));
+  }
+}
+
 std::string CalculatorController::evaluate_str() {
   std::string str;
 
@@ -60,8 +115,21 @@ std::string CalculatorController::evaluate_str() {
   return str;
 }
 
-long double& CalculatorController::variable() noexcept {
+long double CalculatorController::variable() const noexcept {
   return model_->variable();
 }
 
+void CalculatorController::set_variable(long double var) noexcept {
+  model_->set_variable(var);
+}
+
+std::shared_ptr<const CalculatorModel::Program> CalculatorController::compiled()
+    const noexcept {
+  return model_->compiled();
+}
+
+const ExpressionCache& CalculatorController::cache() const noexcept {
+  return cache_;
+}
+
 }  // namespace s21
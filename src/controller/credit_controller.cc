@@ -36,11 +36,58 @@ void CreditController::addCreditData(long double amount, std::size_t term,
 }
 
 void CreditController::calculateCredit() noexcept {
+  applySettings();
   model_->calculatePayments();
 }
 
-const std::vector<std::vector<std::string>>& CreditController::table()
-    const noexcept {
+BaseModel::Totals CreditController::calculateTotals() noexcept {
+  applySettings();
+
+  return model_->calculateTotals();
+}
+
+BaseModel::Totals CreditController::streamPayments(
+    const BaseModel::RowCallback& callback) {
+  applySettings();
+
+  return model_->streamPayments(callback);
+}
+
+BaseModel::Totals CreditController::quoteCredit() const noexcept {
+  return model_->quote();
+}
+
+bool CreditController::loadHolidays(const std::string& path) noexcept {
+  HolidayCalendar holidays;
+
+  try {
+    holidays.load(path);
+  } catch (const std::invalid_argument& exception) {
+    return false;
+  }
+
+  holidays_ = std::move(holidays);
+  shift_ = true;
+
+  return true;
+}
+
+void CreditController::clearHolidays() noexcept { shift_ = false; }
+
+void CreditController::setDayCount(DayCount convention) noexcept {
+  day_count_ = convention;
+}
+
+void CreditController::applySettings() noexcept {
+  model_->setHolidays(shift_ ? &holidays_ : nullptr);
+  model_->setDayCount(day_count_);
+}
+
+const BaseModel::Schedule& CreditController::schedule() const noexcept {
+  return model_->schedule();
+}
+
+std::vector<std::vector<std::string>> CreditController::table() const {
   return model_->table();
 }
 
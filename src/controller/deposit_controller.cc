@@ -37,9 +37,23 @@ void DepositController::addDepositData(long double amount, std::size_t term,
 }
 
 void DepositController::calculateDeposit() noexcept {
+  applySettings();
   model_->calculatePayments();
 }
 
+BaseModel::Totals DepositController::calculateTotals() noexcept {
+  applySettings();
+
+  return model_->calculateTotals();
+}
+
+BaseModel::Totals DepositController::streamPayments(
+    const BaseModel::RowCallback& callback) {
+  applySettings();
+
+  return model_->streamPayments(callback);
+}
+
 void DepositController::addOperation(long double sum, OperationType type,
                                      std::size_t day, std::size_t month,
                                      std::size_t year) noexcept {
@@ -47,8 +61,58 @@ void DepositController::addOperation(long double sum, OperationType type,
   model_->addOperation(op);
 }
 
-const std::vector<std::vector<std::string>>& DepositController::table()
-    const noexcept {
+std::size_t DepositController::addOperations(
+    const std::vector<long double>& sums,
+    const std::vector<OperationType>& types,
+    const std::vector<std::string_view>& dates) noexcept {
+  std::vector<Date> parsed;
+  std::vector<Date::ParseResult> results;
+  std::size_t rows{std::min({sums.size(), types.size(), dates.size()})};
+  std::size_t added{};
+
+  Date::parse(dates, parsed, results);
+
+  for (std::size_t i{}; i < rows; ++i) {
+    if (results[i] == Date::ParseResult::PARSE_OK) {
+      model_->addOperation({sums[i], types[i], parsed[i]});
+      ++added;
+    }
+  }
+
+  return added;
+}
+
+bool DepositController::loadHolidays(const std::string& path) noexcept {
+  HolidayCalendar holidays;
+
+  try {
+    holidays.load(path);
+  } catch (const std::invalid_argument& exception) {
+    return false;
+  }
+
+  holidays_ = std::move(holidays);
+  shift_ = true;
+
+  return true;
+}
+
+void DepositController::clearHolidays() noexcept { shift_ = false; }
+
+void DepositController::setDayCount(DayCount convention) noexcept {
+  day_count_ = convention;
+}
+
+void DepositController::applySettings() noexcept {
+  model_->setHolidays(shift_ ? &holidays_ : nullptr);
+  model_->setDayCount(day_count_);
+}
+
+const BaseModel::Schedule& DepositController::schedule() const noexcept {
+  return model_->schedule();
+}
+
+std::vector<std::vector<std::string>> DepositController::table() const {
   return model_->table();
 }
 
@@ -0,0 +1,55 @@
+/**
+ * @file calendar.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the Calendar class.
+ * @version 1.0
+ * @date 2024-10-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_CALENDAR_H_
+#define SRC_INCLUDE_ADDITIONAL_CALENDAR_H_
+
+#include <algorithm>
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+#include "include/additional/date.h"
+
+namespace s21 {
+
+class HolidayCalendar;
+
+/// @brief Precomputed calendar index and payment schedule generator.
+class Calendar {
+ public:
+  static constexpr Date::DateSize kFirstYear{1900};  ///< First indexed year.
+  static constexpr Date::DateSize kLastYear{2200};   ///< Last indexed year.
+
+  static Date::DaySerial monthStart(Date::DateSize month,
+                                    Date::DateSize year) noexcept;
+  static Date toDate(Date::DaySerial serial) noexcept;
+  static Date addMonths(const Date &date, std::size_t months,
+                        Date::DateSize day) noexcept;
+  static void creditSchedule(const Date &start, std::size_t count,
+                             std::pmr::vector<Date> &dates,
+                             const HolidayCalendar *holidays = nullptr);
+  static std::pmr::vector<Date> depositSchedule(
+      const Date &start, const Date &last, std::size_t days,
+      std::size_t months, const HolidayCalendar *holidays = nullptr,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+ private:
+  static Date::DaySerial monthStart(std::size_t index) noexcept;
+  static std::size_t monthIndex(const Date &date) noexcept;
+  static void addPayment(Date::DaySerial serial, Date::DaySerial &paid,
+                         const HolidayCalendar *holidays,
+                         std::pmr::vector<Date> &dates);
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_CALENDAR_H_
@@ -12,10 +12,13 @@
 #ifndef SRC_INCLUDE_ADDITIONAL_DATE_H_
 #define SRC_INCLUDE_ADDITIONAL_DATE_H_
 
+#include <charconv>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
-#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -25,52 +28,423 @@ namespace s21 {
 class Date {
  public:
   using DateSize = uint16_t;  ///< Type alias for date components.
+  using DaySerial = int32_t;  ///< Type alias for days since 01.01.1970.
+
+  /// @brief Enumeration for the result of date parsing.
+  enum class ParseResult { PARSE_OK, PARSE_BAD_FORMAT, PARSE_BAD_DATE };
+
+  constexpr Date() = default;
+  constexpr Date(DateSize day, DateSize month, DateSize year);
+  constexpr Date(const Date &other) = default;
 
-  Date() = default;
-  Date(DateSize day, DateSize month, DateSize year);
-  Date(const Date &other);
-
-  static bool isYearLeap(DateSize year) noexcept;
-  std::size_t daysPassedInYear() const noexcept;
-  std::size_t daysLeftInYear() const noexcept;
-  Date &addCreditMonth(DateSize init_day) noexcept;
-  Date &addDepositMonth(std::size_t term) noexcept;
-  Date &addDays(std::size_t term) noexcept;
-  std::pair<std::size_t, std::size_t> leapDaysBetween(
+  static constexpr bool isYearLeap(DateSize year) noexcept;
+  static constexpr Date fromSerial(DaySerial serial) noexcept;
+  static ParseResult parse(std::string_view text, Date &date) noexcept;
+  static std::size_t parse(const std::vector<std::string_view> &texts,
+                           std::vector<Date> &dates,
+                           std::vector<ParseResult> &results);
+  constexpr DaySerial serial() const noexcept;
+  constexpr std::size_t daysPassedInYear() const noexcept;
+  constexpr std::size_t daysLeftInYear() const noexcept;
+  constexpr Date &addCreditMonth(DateSize init_day) noexcept;
+  constexpr Date &addDepositMonth(std::size_t term) noexcept;
+  constexpr Date &addDays(std::size_t term) noexcept;
+  constexpr std::pair<std::size_t, std::size_t> leapDaysBetween(
       const Date &end) const noexcept;
 
-  Date &operator=(const Date &other) noexcept;
-  bool operator>(const Date &other) const noexcept;
-  bool operator<(const Date &other) const noexcept;
-  bool operator>=(const Date &other) const noexcept;
-  bool operator<=(const Date &other) const noexcept;
-  bool operator==(const Date &other) const noexcept;
-  bool operator!=(const Date &other) const noexcept;
-  std::size_t operator-(const Date &other) const noexcept;
-  Date operator+(std::size_t days) const noexcept;
-
-  DateSize day() const noexcept;
-  DateSize month() const noexcept;
-  DateSize year() const noexcept;
+  constexpr Date &operator=(const Date &other) noexcept = default;
+  constexpr bool operator>(const Date &other) const noexcept;
+  constexpr bool operator<(const Date &other) const noexcept;
+  constexpr bool operator>=(const Date &other) const noexcept;
+  constexpr bool operator<=(const Date &other) const noexcept;
+  constexpr bool operator==(const Date &other) const noexcept;
+  constexpr bool operator!=(const Date &other) const noexcept;
+  constexpr std::size_t operator-(const Date &other) const noexcept;
+  constexpr Date operator+(std::size_t days) const noexcept;
+
+  constexpr DateSize day() const noexcept;
+  constexpr DateSize month() const noexcept;
+  constexpr DateSize year() const noexcept;
   std::string currentDate() const noexcept;
+  char *format(char *first, char *last) const noexcept;
 
   static const DateSize kYearMonths = 12;    ///< Number of months in a year.
   static const std::size_t kYearDays = 365;  ///< Number of days non-leap year.
   static const std::size_t kLeapYearDays = 366;  ///< Number of days leap year.
+  static const std::size_t kFormatSize = 11;  ///< Longest DD.MM.YYYY length.
 
  private:
-  /// @brief Enumeration for date comparison.
-  enum class DateCompare { DATE_EQUAL, DATE_BEFORE, DATE_AFTER };
+  static constexpr bool isValidDate(DateSize day, DateSize month,
+                                    DateSize year) noexcept;
+  static constexpr DateSize daysInMonth(DateSize month, DateSize year) noexcept;
+  static constexpr std::uint32_t pack(DateSize day, DateSize month,
+                                      DateSize year) noexcept;
+  static constexpr DaySerial daysFromCivil(DateSize day, DateSize month,
+                                           DateSize year) noexcept;
+  static constexpr std::size_t leapYearsBefore(DateSize year) noexcept;
+  constexpr std::size_t leapDaysPassed() const noexcept;
+
+  /// @brief Days before each month of a non-leap and a leap year.
+  static constexpr DateSize kCumulativeDays[2][kYearMonths + 1]{
+      {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+      {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}};
 
-  bool isValidDate() const noexcept;
-  DateCompare compareDate(const Date &other) const noexcept;
-  DateSize daysInMonth(DateSize month) const noexcept;
+  static constexpr std::uint32_t kDayBits = 5;    ///< Bits of the day.
+  static constexpr std::uint32_t kMonthBits = 4;  ///< Bits of the month.
 
-  DateSize day_{};    ///< Day of the month.
-  DateSize month_{};  ///< Month of the year.
-  DateSize year_{};   ///< Year.
+  /// @brief The date packed as year << 9 | month << 5 | day, so that the
+  /// packed values are ordered as the dates.
+  std::uint32_t packed_{};
 };
 
+/**
+ * @brief Constructs a Date object with the given day, month, and year.
+ * @param day The day of the month.
+ * @param month The month of the year.
+ * @param year The year.
+ * @throws std::invalid_argument if the date is invalid.
+ */
+constexpr Date::Date(DateSize day, DateSize month, DateSize year) {
+  if (!isValidDate(day, month, year)) {
+    throw std::invalid_argument("Date:: invalid date");
+  }
+
+  packed_ = pack(day, month, year);
+}
+
+/**
+ * @brief Packs the date components into a single integer.
+ * @param day The day of the month.
+ * @param month The month of the year.
+ * @param year The year.
+ * @return The packed date.
+ */
+constexpr std::uint32_t Date::pack(DateSize day, DateSize month,
+                                   DateSize year) noexcept {
+  return std::uint32_t{year} << (kMonthBits + kDayBits) |
+         std::uint32_t{month} << kDayBits | day;
+}
+
+/**
+ * @brief Returns the number of days in the given month.
+ * @param month The month.
+ * @param year The year.
+ * @return The number of days in the month.
+ */
+constexpr Date::DateSize Date::daysInMonth(DateSize month,
+                                           DateSize year) noexcept {
+  const DateSize *days{kCumulativeDays[isYearLeap(year)]};
+
+  return days[month] - days[month - 1];
+}
+
+/**
+ * @brief Checks if the date components form a valid date.
+ * @param day The day of the month.
+ * @param month The month of the year.
+ * @param year The year.
+ * @return True if the date is valid, false otherwise.
+ */
+constexpr bool Date::isValidDate(DateSize day, DateSize month,
+                                 DateSize year) noexcept {
+  bool valid{true};
+
+  if (!day || !month || !year) {
+    valid = false;
+  } else if (month > kYearMonths || day > daysInMonth(month, year)) {
+    valid = false;
+  }
+
+  return valid;
+}
+
+/**
+ * @brief Checks if the given year is a leap year.
+ * @param year The year to check.
+ * @return True if the year is a leap year, false otherwise.
+ */
+constexpr bool Date::isYearLeap(DateSize year) noexcept {
+  const std::size_t kBigLeapInterval = 400;
+  const std::size_t kSmallLeapInterval = 4;
+  const std::size_t kLeapExcectInterval = 100;
+  bool leap{false};
+
+  if (!(year % kBigLeapInterval)) {
+    leap = true;
+  } else if (!(year % kSmallLeapInterval) && (year % kLeapExcectInterval)) {
+    leap = true;
+  }
+
+  return leap;
+}
+
+/**
+ * @brief Returns the serial day number of the given date.
+ *
+ * Counts the days in 400-year eras of a calendar starting on March 1, so
+ * that the leap day is the last day of the year.
+ * @param day The day of the month.
+ * @param month The month of the year.
+ * @param year The year.
+ * @return The number of days since 01.01.1970.
+ */
+constexpr Date::DaySerial Date::daysFromCivil(DateSize day, DateSize month,
+                                              DateSize year) noexcept {
+  const DaySerial kEraDays = 146097;
+  const DaySerial kEpochShift = 719468;
+  DaySerial y = year - (month <= 2);
+  DaySerial era = y / 400;
+  DaySerial year_of_era = y - era * 400;
+  DaySerial day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 +
+                          day - 1;
+  DaySerial day_of_era = year_of_era * 365 + year_of_era / 4 -
+                         year_of_era / 100 + day_of_year;
+
+  return era * kEraDays + day_of_era - kEpochShift;
+}
+
+/**
+ * @brief Constructs a Date object from the serial day number.
+ * @param serial The number of days since 01.01.1970.
+ * @return The Date object.
+ */
+constexpr Date Date::fromSerial(DaySerial serial) noexcept {
+  const DaySerial kEraDays = 146097;
+  const DaySerial kEpochShift = 719468;
+  Date date;
+  DaySerial days = serial + kEpochShift;
+  DaySerial era = days / kEraDays;
+  DaySerial day_of_era = days - era * kEraDays;
+  DaySerial year_of_era = (day_of_era - day_of_era / 1460 +
+                           day_of_era / 36524 - day_of_era / 146096) /
+                          365;
+  DaySerial day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 -
+                                        year_of_era / 100);
+  DaySerial shifted_month = (5 * day_of_year + 2) / 153;
+
+  DateSize day = static_cast<DateSize>(day_of_year -
+                                       (153 * shifted_month + 2) / 5 + 1);
+  DateSize month = static_cast<DateSize>(
+      shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+  DateSize year =
+      static_cast<DateSize>(year_of_era + era * 400 + (month <= 2));
+
+  date.packed_ = pack(day, month, year);
+
+  return date;
+}
+
+/**
+ * @brief Returns the serial day number of the date.
+ * @return The number of days since 01.01.1970.
+ */
+constexpr Date::DaySerial Date::serial() const noexcept {
+  return daysFromCivil(day(), month(), year());
+}
+
+/**
+ * @brief Returns the number of days passed in the current year.
+ * @return The number of days passed in the current year.
+ */
+constexpr std::size_t Date::daysPassedInYear() const noexcept {
+  return kCumulativeDays[isYearLeap(year())][month() - 1] + day();
+}
+
+/**
+ * @brief Returns the number of days left in the current year.
+ * @return The number of days left in the current year.
+ */
+constexpr std::size_t Date::daysLeftInYear() const noexcept {
+  return ((isYearLeap(year())) ? kLeapYearDays : kYearDays) -
+         daysPassedInYear();
+}
+
+/**
+ * @brief Checks if two Date objects are equal.
+ * @param other The Date object to compare.
+ * @return True if the Date objects are equal, false otherwise.
+ */
+constexpr bool Date::operator==(const Date &other) const noexcept {
+  return packed_ == other.packed_;
+}
+
+/**
+ * @brief Checks if two Date objects are not equal.
+ * @param other The Date object to compare.
+ * @return True if the Date objects are not equal, false otherwise.
+ */
+constexpr bool Date::operator!=(const Date &other) const noexcept {
+  return packed_ != other.packed_;
+}
+
+/**
+ * @brief Checks if one Date object is less than another.
+ * @param other The Date object to compare.
+ * @return True if the Date object is less than the other, false otherwise.
+ */
+constexpr bool Date::operator<(const Date &other) const noexcept {
+  return packed_ < other.packed_;
+}
+
+/**
+ * @brief Checks if one Date object is greater than another.
+ * @param other The Date object to compare.
+ * @return True if the Date object is greater than the other, false otherwise.
+ */
+constexpr bool Date::operator>(const Date &other) const noexcept {
+  return packed_ > other.packed_;
+}
+
+/**
+ * @brief Checks if one Date object is less than or equal to another.
+ * @param other The Date object to compare.
+ * @return True if the Date object is less than or equal to the other, false
+ * otherwise.
+ */
+constexpr bool Date::operator<=(const Date &other) const noexcept {
+  return packed_ <= other.packed_;
+}
+
+/**
+ * @brief Checks if one Date object is greater than or equal to another.
+ * @param other The Date object to compare.
+ * @return True if the Date object is greater than or equal to the other, false
+ * otherwise.
+ */
+constexpr bool Date::operator>=(const Date &other) const noexcept {
+  return packed_ >= other.packed_;
+}
+
+/**
+ * @brief Returns the difference in days between two Date objects.
+ * @param other The Date object to subtract.
+ * @return The difference in days.
+ */
+constexpr std::size_t Date::operator-(const Date &other) const noexcept {
+  return serial() - other.serial();
+}
+
+/**
+ * @brief Adds a number of days to the Date object.
+ * @param days The number of days to add.
+ * @return The new Date object.
+ */
+constexpr Date Date::operator+(std::size_t days) const noexcept {
+  return Date{*this}.addDays(days);
+}
+
+/**
+ * @brief Adds a credit month to the Date object.
+ * @param init_day The initial day of the month.
+ * @return A reference to the modified Date object.
+ */
+constexpr Date &Date::addCreditMonth(DateSize init_day) noexcept {
+  DateSize next_month = month();
+  DateSize next_year = year();
+
+  if (next_month + 1 > kYearMonths) {
+    next_month = 1;
+    ++next_year;
+  } else {
+    ++next_month;
+  }
+
+  if (init_day > daysInMonth(next_month, next_year)) {
+    init_day = daysInMonth(next_month, next_year);
+  }
+
+  packed_ = pack(init_day, next_month, next_year);
+
+  return *this;
+}
+
+/**
+ * @brief Adds a deposit month to the Date object.
+ * @param term The number of months to add.
+ * @return A reference to the modified Date object.
+ */
+constexpr Date &Date::addDepositMonth(std::size_t term) noexcept {
+  std::size_t months{month() - 1 + term};
+  DateSize next_month = months % kYearMonths + 1;
+  DateSize next_year = year() + months / kYearMonths;
+
+  addDays(daysFromCivil(1, next_month, next_year) -
+          daysFromCivil(1, month(), year()));
+
+  return *this;
+}
+
+/**
+ * @brief Adds a number of days to the Date object.
+ * @param term The number of days to add.
+ * @return A reference to the modified Date object.
+ */
+constexpr Date &Date::addDays(std::size_t term) noexcept {
+  *this = fromSerial(serial() + static_cast<DaySerial>(term));
+
+  return *this;
+}
+
+/**
+ * @brief Returns the number of leap years before the given year.
+ * @param year The year.
+ * @return The number of leap years from 1 to year - 1.
+ */
+constexpr std::size_t Date::leapYearsBefore(DateSize year) noexcept {
+  const std::size_t kBigLeapInterval = 400;
+  const std::size_t kSmallLeapInterval = 4;
+  const std::size_t kLeapExcectInterval = 100;
+  std::size_t years = year - 1;
+
+  return years / kSmallLeapInterval - years / kLeapExcectInterval +
+         years / kBigLeapInterval;
+}
+
+/**
+ * @brief Returns the number of leap year days up to the date.
+ * @return The number of days of leap years from 01.01.0001 to the date.
+ */
+constexpr std::size_t Date::leapDaysPassed() const noexcept {
+  return kLeapYearDays * leapYearsBefore(year()) +
+         (isYearLeap(year()) ? daysPassedInYear() : 0);
+}
+
+/**
+ * @brief Returns the number of default and leap days between two Date objects.
+ * @param end The end Date object.
+ * @return A pair containing the number of default and leap days.
+ */
+constexpr std::pair<std::size_t, std::size_t> Date::leapDaysBetween(
+    const Date &end) const noexcept {
+  std::size_t leap_days{end.leapDaysPassed() - leapDaysPassed()};
+
+  return {(end - *this) - leap_days, leap_days};
+}
+
+/**
+ * @brief Returns the day of the month.
+ * @return The day of the month.
+ */
+constexpr Date::DateSize Date::day() const noexcept {
+  return packed_ & ((1u << kDayBits) - 1);
+}
+
+/**
+ * @brief Returns the month of the year.
+ * @return The month of the year.
+ */
+constexpr Date::DateSize Date::month() const noexcept {
+  return (packed_ >> kDayBits) & ((1u << kMonthBits) - 1);
+}
+
+/**
+ * @brief Returns the year.
+ * @return The year.
+ */
+constexpr Date::DateSize Date::year() const noexcept {
+  return static_cast<DateSize>(packed_ >> (kMonthBits + kDayBits));
+}
+
 }  // namespace s21
 
 #endif  // SRC_INCLUDE_ADDITIONAL_DATE_H_
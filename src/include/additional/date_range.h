@@ -0,0 +1,120 @@
+/**
+ * @file date_range.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the DateRange class.
+ * @version 1.0
+ * @date 2024-10-12
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_DATE_RANGE_H_
+#define SRC_INCLUDE_ADDITIONAL_DATE_RANGE_H_
+
+#include <cstddef>
+#include <iterator>
+
+#include "include/additional/date.h"
+
+namespace s21 {
+
+/// @brief Range of dates from the first one up to the last one excluded.
+class DateRange {
+ public:
+  /// @brief Iterator over the dates of the range.
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Date;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Date *;
+    using reference = Date;
+
+    constexpr Iterator(Date::DaySerial serial, Date::DaySerial step) noexcept
+        : serial_{serial}, step_{step} {}
+
+    constexpr Date operator*() const noexcept {
+      return Date::fromSerial(serial_);
+    }
+
+    constexpr Iterator &operator++() noexcept {
+      serial_ += step_;
+
+      return *this;
+    }
+
+    constexpr Iterator operator++(int) noexcept {
+      Iterator previous{*this};
+      serial_ += step_;
+
+      return previous;
+    }
+
+    constexpr bool operator==(const Iterator &other) const noexcept {
+      return serial_ == other.serial_;
+    }
+
+    constexpr bool operator!=(const Iterator &other) const noexcept {
+      return serial_ != other.serial_;
+    }
+
+   private:
+    Date::DaySerial serial_;  ///< The current day.
+    Date::DaySerial step_;    ///< The days between the dates.
+  };
+
+  constexpr DateRange(const Date &first, const Date &last,
+                      std::size_t step = 1) noexcept;
+
+  constexpr Iterator begin() const noexcept;
+  constexpr Iterator end() const noexcept;
+  constexpr std::size_t size() const noexcept;
+
+ private:
+  Date::DaySerial first_;  ///< The first day.
+  Date::DaySerial step_;   ///< The days between the dates.
+  std::size_t size_;       ///< The number of dates.
+};
+
+/**
+ * @brief Constructs a DateRange object.
+ * @param first The first date.
+ * @param last The date after the range, not included.
+ * @param step The days between the dates, at least one.
+ */
+constexpr DateRange::DateRange(const Date &first, const Date &last,
+                               std::size_t step) noexcept
+    : first_{first.serial()},
+      step_{static_cast<Date::DaySerial>(step ? step : 1)},
+      size_{} {
+  Date::DaySerial days{last.serial() - first_};
+
+  if (days > 0) size_ = static_cast<std::size_t>((days + step_ - 1) / step_);
+}
+
+/**
+ * @brief Returns the iterator to the first date.
+ * @return The iterator.
+ */
+constexpr DateRange::Iterator DateRange::begin() const noexcept {
+  return Iterator{first_, step_};
+}
+
+/**
+ * @brief Returns the iterator past the last date.
+ * @return The iterator.
+ */
+constexpr DateRange::Iterator DateRange::end() const noexcept {
+  return Iterator{first_ + static_cast<Date::DaySerial>(size_) * step_, step_};
+}
+
+/**
+ * @brief Returns the number of dates in the range.
+ * @return The number of dates.
+ */
+constexpr std::size_t DateRange::size() const noexcept { return size_; }
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_DATE_RANGE_H_
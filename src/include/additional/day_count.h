@@ -0,0 +1,138 @@
+/**
+ * @file day_count.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the day count conventions.
+ * @version 1.0
+ * @date 2024-10-12
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_DAY_COUNT_H_
+#define SRC_INCLUDE_ADDITIONAL_DAY_COUNT_H_
+
+#include <algorithm>
+#include <utility>
+
+#include "include/additional/date.h"
+
+namespace s21 {
+
+/// @brief Enumeration for the day count convention of the interest.
+enum class DayCount { ACT_ACT_ISDA, ACT_365_FIXED, ACT_360, THIRTY_360 };
+
+/// @brief Actual days split into 365 and 366 day years.
+struct ActActIsda {
+  /**
+   * @brief Returns the fraction of a year between two dates.
+   * @param begin The start date of the period.
+   * @param end The end date of the period.
+   * @return The year fraction.
+   */
+  static constexpr long double yearFraction(const Date &begin,
+                                            const Date &end) noexcept {
+    std::pair<std::size_t, std::size_t> days{begin.leapDaysBetween(end)};
+
+    return static_cast<long double>(days.first) / Date::kYearDays +
+           static_cast<long double>(days.second) / Date::kLeapYearDays;
+  }
+};
+
+/// @brief Actual days over a fixed 365 day year.
+struct Act365Fixed {
+  /**
+   * @brief Returns the fraction of a year between two dates.
+   * @param begin The start date of the period.
+   * @param end The end date of the period.
+   * @return The year fraction.
+   */
+  static constexpr long double yearFraction(const Date &begin,
+                                            const Date &end) noexcept {
+    return static_cast<long double>(end - begin) / Date::kYearDays;
+  }
+};
+
+/// @brief Actual days over a 360 day year.
+struct Act360 {
+  /**
+   * @brief Returns the fraction of a year between two dates.
+   * @param begin The start date of the period.
+   * @param end The end date of the period.
+   * @return The year fraction.
+   */
+  static constexpr long double yearFraction(const Date &begin,
+                                            const Date &end) noexcept {
+    return static_cast<long double>(end - begin) / kYearDays;
+  }
+
+  static constexpr std::size_t kYearDays = 360;  ///< Days of the year.
+};
+
+/// @brief 30 day months over a 360 day year with the ISDA end of month rule.
+struct Thirty360 {
+  /**
+   * @brief Returns the fraction of a year between two dates.
+   * @param begin The start date of the period.
+   * @param end The end date of the period.
+   * @return The year fraction.
+   */
+  static constexpr long double yearFraction(const Date &begin,
+                                            const Date &end) noexcept {
+    long long begin_day{std::min<long long>(begin.day(), kMonthDays)};
+    long long end_day{end.day()};
+
+    if (begin_day == kMonthDays) end_day = std::min(end_day, kMonthDays);
+
+    long long days{(end.year() - begin.year()) * kYearDays +
+                   (end.month() - begin.month()) * kMonthDays + end_day -
+                   begin_day};
+
+    return static_cast<long double>(days) / kYearDays;
+  }
+
+  static constexpr long long kMonthDays = 30;  ///< Days of the month.
+  static constexpr long long kYearDays = 360;  ///< Days of the year.
+};
+
+/**
+ * @brief Calls the function with the policy of the day count convention.
+ *
+ * Dispatching once outside of a loop lets the loop body be instantiated for
+ * every convention without branches inside it.
+ * @param convention The day count convention.
+ * @param function The function taking the policy object.
+ * @return The result of the function.
+ */
+template <class Function>
+constexpr decltype(auto) withDayCount(DayCount convention,
+                                      Function &&function) {
+  switch (convention) {
+    case DayCount::ACT_365_FIXED:
+      return function(Act365Fixed{});
+    case DayCount::ACT_360:
+      return function(Act360{});
+    case DayCount::THIRTY_360:
+      return function(Thirty360{});
+    default:
+      return function(ActActIsda{});
+  }
+}
+
+/**
+ * @brief Returns the fraction of a year between two dates.
+ * @param convention The day count convention.
+ * @param begin The start date of the period.
+ * @param end The end date of the period.
+ * @return The year fraction.
+ */
+constexpr long double yearFraction(DayCount convention, const Date &begin,
+                                   const Date &end) noexcept {
+  return withDayCount(convention, [&begin, &end](auto policy) {
+    return decltype(policy)::yearFraction(begin, end);
+  });
+}
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_DAY_COUNT_H_
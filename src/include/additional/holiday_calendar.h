@@ -0,0 +1,55 @@
+/**
+ * @file holiday_calendar.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the HolidayCalendar class.
+ * @version 1.0
+ * @date 2024-10-10
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_HOLIDAY_CALENDAR_H_
+#define SRC_INCLUDE_ADDITIONAL_HOLIDAY_CALENDAR_H_
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/additional/calendar.h"
+#include "include/additional/date.h"
+
+namespace s21 {
+
+/// @brief Calendar of weekends and holidays stored as a bitset over days.
+class HolidayCalendar {
+ public:
+  explicit HolidayCalendar(Date::DateSize first_year = Calendar::kFirstYear,
+                           Date::DateSize last_year = Calendar::kLastYear);
+
+  void load(const std::string &path);
+  void addHoliday(const Date &date) noexcept;
+  void clear() noexcept;
+
+  bool isBusinessDay(Date::DaySerial serial) const noexcept;
+  bool isBusinessDay(const Date &date) const noexcept;
+  Date::DaySerial nextBusinessDay(Date::DaySerial serial) const noexcept;
+  Date nextBusinessDay(const Date &date) const noexcept;
+
+ private:
+  static bool isWeekend(Date::DaySerial serial) noexcept;
+  static std::size_t lowestBit(std::uint64_t word) noexcept;
+
+  static constexpr std::size_t kWordBits{64};  ///< Days per bitset word.
+
+  Date::DaySerial first_;  ///< The first indexed day.
+  Date::DaySerial last_;   ///< The day after the last indexed one.
+  std::vector<std::uint64_t> closed_;  ///< Set bits mark non-business days.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_HOLIDAY_CALENDAR_H_
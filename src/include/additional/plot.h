@@ -17,9 +17,17 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QVector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
 
 #include "include/additional/base_window.h"
 #include "include/additional/qcustomplot.h"
+#include "include/additional/sampler.h"
+#include "include/additional/segment_cache.h"
 #include "include/controller/calculator_controller.h"
 
 namespace s21 {
@@ -29,9 +37,11 @@ class Plot : public BaseWindow {
 
  public:
   Plot();
+  ~Plot();
 
   void build(CalculatorController *controller);
   bool isValidInput(QLineEdit *line) const noexcept;
+  void setTolerance(double tolerance) noexcept;
 
  signals:
   void windowClosed();
@@ -41,12 +51,42 @@ class Plot : public BaseWindow {
 
  private slots:
   void onTextChanged(const QString &text);
+  void onRangeChanged(const QCPRange &range);
 
  private:
   void allocateMemory();
   void initView();
   bool isValidAll() noexcept;
 
+  /// @brief Structure to hold the chunks sampled by a background job.
+  struct Job {
+    CalculatorController *controller;  ///< The evaluating controller.
+    std::shared_ptr<const CalculatorModel::Program> program;  ///< Function.
+    Sampler::Range range;           ///< The y range and the finest step.
+    double tolerance;               ///< The sampling tolerance.
+    int level;                      ///< The resolution level.
+    std::vector<long long> chunks;  ///< The chunks to sample.
+    std::size_t generation;         ///< The number of the job.
+    std::size_t revision;           ///< The revision of the cache.
+  };
+
+  void cancel();
+  void resample();
+  void refresh();
+  void sample(Job job);
+  void publish(const Job &job, long long chunk, const Sampler &sampler);
+
+  static constexpr double kSubpixel{8};  ///< Refined samples per pixel.
+
+  std::vector<std::future<void>> workers_;  ///< Unfinished plotting jobs.
+  std::atomic<std::size_t> generation_{};  ///< The number of the latest job.
+  CalculatorController *controller_{};     ///< The controller of the graph.
+  std::shared_ptr<const CalculatorModel::Program> program_;  ///< Function.
+  SegmentCache cache_;      ///< Sampled chunks of the function.
+  std::size_t revision_{};  ///< The number of cache invalidations.
+  int level_{};             ///< The resolution level of the view.
+  double min_step_{};       ///< The finest step set by the user.
+  double tolerance_{Sampler::kDefaultTolerance};  ///< Sampling tolerance.
   QCustomPlot *plot_;
   QGridLayout *settings_;
   QLineEdit *xbegin_, *xend_, *ybegin_, *yend_, *step_;
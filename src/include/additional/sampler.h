@@ -0,0 +1,74 @@
+/**
+ * @file sampler.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the Sampler class.
+ * @version 1.0
+ * @date 2024-10-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_SAMPLER_H_
+#define SRC_INCLUDE_ADDITIONAL_SAMPLER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace s21 {
+
+/// @brief Adaptive sampler of a function graph refined pass by pass.
+class Sampler {
+ public:
+  /// @brief Evaluates the function for n arguments.
+  using Evaluator =
+      std::function<void(const double *xs, double *out, std::size_t n)>;
+  /// @brief Tells whether the sampling must stop.
+  using Stop = std::function<bool()>;
+
+  /// @brief Structure to hold the sampled range.
+  struct Range {
+    double x_begin;  ///< The first x value.
+    double x_end;    ///< The last x value.
+    double y_begin;  ///< The lower visible y value.
+    double y_end;    ///< The upper visible y value.
+    double step;     ///< The smallest distance between the x values.
+  };
+
+  static constexpr double kDefaultTolerance{1e-3};  ///< Part of the height.
+
+  explicit Sampler(const Range &range, double tolerance = kDefaultTolerance);
+
+  bool refine(const Evaluator &evaluate, const Stop &stop = {});
+  const std::vector<double> &x() const noexcept;
+  const std::vector<double> &y() const noexcept;
+  std::size_t evaluations() const noexcept;
+
+ private:
+  void mark();
+  void merge(const std::vector<double> &xs, const std::vector<double> &ys);
+  void trace();
+  bool canSplit(std::size_t i) const noexcept;
+  bool isBent(std::size_t i) const noexcept;
+  bool isJump(std::size_t i) const noexcept;
+  bool isHidden(double a, double b) const noexcept;
+
+  static constexpr std::size_t kInitialSamples{256};  ///< First pass size.
+  static constexpr std::size_t kMaxSamples{1 << 20};  ///< Refinement limit.
+  static constexpr std::size_t kBatchSamples{4096};  ///< Points per check.
+  static constexpr double kJumpRatio{0.5};  ///< Part of the height to break.
+
+  Range range_;               ///< The sampled range.
+  double tolerance_;          ///< The allowed deviation in y units.
+  double height_;             ///< The visible height.
+  std::size_t evaluations_{};  ///< The number of evaluated points.
+  std::vector<double> xs_, ys_;  ///< The sampled points in ascending order.
+  std::vector<char> split_;      ///< Intervals to split in the next pass.
+  std::vector<double> x_, y_;    ///< The graph with NaN at the breaks.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_SAMPLER_H_
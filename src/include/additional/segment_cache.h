@@ -0,0 +1,64 @@
+/**
+ * @file segment_cache.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the SegmentCache class.
+ * @version 1.0
+ * @date 2024-10-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_SEGMENT_CACHE_H_
+#define SRC_INCLUDE_ADDITIONAL_SEGMENT_CACHE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/// @brief Cache of sampled graph chunks keyed by resolution and position.
+class SegmentCache {
+ public:
+  /// @brief Structure to hold the sampled points of one chunk.
+  struct Segment {
+    std::vector<double> x;  ///< The x values in ascending order.
+    std::vector<double> y;  ///< The y values with NaN at the breaks.
+  };
+
+  static constexpr int kChunkPixels{256};  ///< The chunk width in pixels.
+
+  explicit SegmentCache(std::size_t capacity = kDefaultCapacity);
+
+  static int level(double width, int pixels) noexcept;
+  static double resolution(int level) noexcept;
+  static double chunkWidth(int level) noexcept;
+
+  std::vector<long long> missing(int level, double begin, double end) const;
+  void insert(int level, long long chunk, Segment segment);
+  void collect(int level, double begin, double end, std::vector<double> &x,
+               std::vector<double> &y) const;
+  void clear() noexcept;
+  std::size_t size() const noexcept;
+
+ private:
+  using Key = std::pair<int, long long>;  ///< Level and chunk index.
+
+  static constexpr std::size_t kDefaultCapacity{1024};  ///< Default capacity.
+  static constexpr int kMaxLevel{1000};  ///< Covers the range of double.
+  static constexpr long long kMaxChunks{256};  ///< Chunks per request.
+  static constexpr double kMaxChunk{0x1p62};   ///< The largest chunk index.
+
+  static std::pair<long long, long long> chunks(int level, double begin,
+                                                double end) noexcept;
+
+  std::size_t capacity_;             ///< The maximum number of segments.
+  std::map<Key, Segment> segments_;  ///< Segments by level and chunk.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_SEGMENT_CACHE_H_
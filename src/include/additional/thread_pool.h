@@ -0,0 +1,67 @@
+/**
+ * @file thread_pool.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the ThreadPool class.
+ * @version 1.0
+ * @date 2024-10-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_ADDITIONAL_THREAD_POOL_H_
+#define SRC_INCLUDE_ADDITIONAL_THREAD_POOL_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+/// @brief Pool of worker threads running indexed tasks with work stealing.
+class ThreadPool {
+ public:
+  using Task = std::function<void(std::size_t)>;  ///< Task taking its index.
+
+  explicit ThreadPool(std::size_t threads = 0);
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool &operator=(const ThreadPool &other) = delete;
+  ~ThreadPool();
+
+  void parallelFor(std::size_t tasks, const Task &task);
+  std::size_t size() const noexcept;
+
+ private:
+  /// @brief Structure to hold the task indices of one thread.
+  struct Queue {
+    std::mutex mutex;               ///< Guards the task indices.
+    std::deque<std::size_t> tasks;  ///< Indices of the pending tasks.
+  };
+
+  void workerLoop(std::size_t id);
+  void runTasks(std::size_t id);
+  bool popTask(std::size_t id, std::size_t &task);
+  bool stealTask(std::size_t id, std::size_t &task);
+
+  std::vector<std::thread> workers_;  ///< The worker threads.
+  std::vector<std::unique_ptr<Queue>> queues_;  ///< Caller and worker queues.
+  std::mutex job_mutex_;  ///< Serializes parallelFor calls.
+  std::mutex mutex_;      ///< Guards the state of the current job.
+  std::condition_variable start_;  ///< Signals a new job or stop.
+  std::condition_variable done_;   ///< Signals finished workers.
+  const Task *task_{};             ///< The task of the current job.
+  std::size_t generation_{};       ///< The number of started jobs.
+  std::size_t active_{};           ///< Workers busy with the current job.
+  std::exception_ptr error_;       ///< The first exception of the job.
+  bool stop_{false};               ///< Whether the workers must exit.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_ADDITIONAL_THREAD_POOL_H_
@@ -12,9 +12,14 @@
 #ifndef SRC_INCLUDE_CONTROLLER_CALCULATOR_CONTROLLER_H_
 #define SRC_INCLUDE_CONTROLLER_CALCULATOR_CONTROLLER_H_
 
+#include <cmath>
+#include <memory>
+#include <mutex>
 #include <string>
 
+#include "include/additional/thread_pool.h"
 #include "include/model/calculator_model.h"
+#include "include/model/expression_cache.h"
 
 namespace s21 {
 
@@ -27,10 +32,25 @@ class CalculatorController {
   void infix_to_postfix(std::string infix, long double var) noexcept;
   std::string evaluate_str();
   long double evaluate_num();
-  long double &variable() noexcept;
+  void evaluate_batch(const double *xs, double *out, std::size_t n) noexcept;
+  void sweep(const double *xs, double *out, std::size_t n) noexcept;
+  void sweep(const CalculatorModel::Program &program, const double *xs,
+             double *out, std::size_t n) noexcept;
+  long double variable() const noexcept;
+  void set_variable(long double var) noexcept;
+  std::shared_ptr<const CalculatorModel::Program> compiled() const noexcept;
+  const ExpressionCache &cache() const noexcept;
 
  private:
+  bool compile(const std::string &infix, long double var);
+
+  static constexpr std::size_t kSweepChunk{512};  ///< Least values per task.
+  static constexpr std::size_t kChunksPerThread{4};  ///< Load balancing.
+
   CalculatorModel *model_;
+  ExpressionCache cache_;
+  std::unique_ptr<ThreadPool> pool_;
+  std::once_flag pool_flag_;
 };
 
 }  // namespace s21
@@ -12,6 +12,7 @@
 #ifndef SRC_INCLUDE_CONTROLLER_CREDIT_CONTROLLER_H_
 #define SRC_INCLUDE_CONTROLLER_CREDIT_CONTROLLER_H_
 
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -31,11 +32,23 @@ class CreditController {
                      long double rate, Type type, std::size_t day,
                      std::size_t month, std::size_t year) noexcept;
   void calculateCredit() noexcept;
-  const std::vector<std::vector<std::string>> &table() const noexcept;
+  BaseModel::Totals calculateTotals() noexcept;
+  BaseModel::Totals streamPayments(const BaseModel::RowCallback &callback);
+  BaseModel::Totals quoteCredit() const noexcept;
+  bool loadHolidays(const std::string &path) noexcept;
+  void clearHolidays() noexcept;
+  void setDayCount(DayCount convention) noexcept;
+  const BaseModel::Schedule &schedule() const noexcept;
+  std::vector<std::vector<std::string>> table() const;
   std::vector<std::string> totalTable() const noexcept;
 
  private:
+  void applySettings() noexcept;
+
   CreditModel *model_;
+  HolidayCalendar holidays_;
+  bool shift_{false};
+  DayCount day_count_{DayCount::ACT_ACT_ISDA};
 };
 
 }  // namespace s21
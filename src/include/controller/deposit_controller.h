@@ -12,7 +12,10 @@
 #ifndef SRC_INCLUDE_CONTROLLER_DEPOSIT_CONTROLLER_H_
 #define SRC_INCLUDE_CONTROLLER_DEPOSIT_CONTROLLER_H_
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "include/model/deposit_model.h"
@@ -34,14 +37,29 @@ class DepositController {
                       Frequency freq, std::size_t day, std::size_t month,
                       std::size_t year) noexcept;
   void calculateDeposit() noexcept;
+  BaseModel::Totals calculateTotals() noexcept;
+  BaseModel::Totals streamPayments(const BaseModel::RowCallback &callback);
   void addOperation(long double sum, OperationType type, std::size_t day,
                     std::size_t month, std::size_t year) noexcept;
-  const std::vector<std::vector<std::string>> &table() const noexcept;
+  std::size_t addOperations(
+      const std::vector<long double> &sums,
+      const std::vector<OperationType> &types,
+      const std::vector<std::string_view> &dates) noexcept;
+  bool loadHolidays(const std::string &path) noexcept;
+  void clearHolidays() noexcept;
+  void setDayCount(DayCount convention) noexcept;
+  const BaseModel::Schedule &schedule() const noexcept;
+  std::vector<std::vector<std::string>> table() const;
   const std::vector<std::vector<std::string>> &taxTable() const noexcept;
   std::vector<std::string> totalTable() const noexcept;
 
  private:
+  void applySettings() noexcept;
+
   DepositModel *model_;
+  HolidayCalendar holidays_;
+  bool shift_{false};
+  DayCount day_count_{DayCount::ACT_ACT_ISDA};
 };
 
 }  // namespace s21
@@ -13,12 +13,17 @@
 #define SRC_INCLUDE_MODEL_BASE_MODEL_H_
 
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <iomanip>
+#include <memory_resource>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "include/additional/date.h"
+#include "include/additional/day_count.h"
+#include "include/additional/holiday_calendar.h"
 
 namespace s21 {
 
@@ -44,6 +49,8 @@ class BaseModel {
     long double rate{};    ///< The interest rate.
     Type type;             ///< The type of the loan.
     Date date;             ///< The start date of the loan.
+    const HolidayCalendar *holidays{};  ///< Business days to pay on, if any.
+    DayCount day_count{DayCount::ACT_ACT_ISDA};  ///< Interest day count.
   };
 
   /// @brief Structure to hold the monthly payment data.
@@ -57,27 +64,85 @@ class BaseModel {
     long double balance{};  ///< The remaining balance.
   };
 
+  /// @brief Structure to hold the totals of the payments.
+  struct Totals {
+   public:
+    long double interest{};        ///< The interest paid / accrued profit.
+    long double debt{};            ///< The debt paid.
+    long double tax{};             ///< The tax on the profit.
+    long double effective_rate{};  ///< The effective annual rate in percent.
+    long double total{};           ///< The total paid / total balance.
+    long double balance{};         ///< The final balance.
+  };
+
+  /// @brief Columnar schedule of the payments.
+  struct Schedule {
+   public:
+    std::size_t size() const noexcept;
+    void clear() noexcept;
+    void reserve(std::size_t rows);
+    void push_back(const Month &month);
+    std::vector<std::string> row(std::size_t index) const;
+
+    std::vector<Date> dates;           ///< The payment dates.
+    std::vector<long double> percent;  ///< The interest parts.
+    std::vector<long double> main;     ///< The main parts.
+    std::vector<long double> summary;  ///< The payments / balance changings.
+    std::vector<long double> balance;  ///< The remaining balances.
+  };
+
+  using RowCallback = std::function<void(const Month &)>;  ///< Row receiver.
+
   BaseModel();
-  virtual ~BaseModel();
+  virtual ~BaseModel() = default;
 
   static long double roundVal(long double value) noexcept;
   static std::string toStr(long double val) noexcept;
 
-  const std::vector<std::vector<std::string>> &table() const noexcept;
+  const Schedule &schedule() const noexcept;
+  std::vector<std::vector<std::string>> table() const;
+  virtual Totals totals() const noexcept = 0;
   virtual std::vector<std::string> totalTable() const noexcept = 0;
-  virtual void calculatePayments() noexcept = 0;
+  virtual void calculatePayments() = 0;
+  Totals calculateTotals() noexcept;
+  Totals streamPayments(const RowCallback &callback);
+  void setHolidays(const HolidayCalendar *holidays) noexcept;
+  void setDayCount(DayCount convention) noexcept;
   virtual void clear() noexcept = 0;
 
  protected:
-  void monthToTable() noexcept;
-  long double formula(const Date &begin, const Date &end) noexcept;
-  virtual void calculatePeriod() noexcept = 0;
-
-  Data *data_;    ///< Pointer to the loan data.
-  Month *month_;  ///< Pointer to the monthly payment data.
-  std::vector<std::vector<std::string>> table_;  ///< Table of payments.
+  void monthToTable();
+  bool storesSchedule() const noexcept;
+  std::pmr::memory_resource *scratch() noexcept;
+  template <class Convention>
+  long double formula(const Date &begin, const Date &end) const noexcept;
+
+  static constexpr std::size_t kArenaSize{4096};  ///< Inline bytes, 1024
+                                                  ///< dates reserved at once.
+
+  Data data_;    ///< The loan data.
+  Month month_;  ///< The monthly payment data.
+  Schedule schedule_;     ///< Schedule of payments.
+  bool summary_{false};  ///< Whether only the totals are calculated.
+  const RowCallback *rows_{};  ///< The receiver of the streamed rows.
+  /// @brief Inline block of the calculation arena.
+  alignas(std::max_align_t) std::byte arena_buffer_[kArenaSize];
+  std::pmr::monotonic_buffer_resource arena_;  ///< Calculation scratch memory.
 };
 
+/**
+ * @brief Calculates the interest for a given period.
+ * @tparam Convention The day count policy of the interest.
+ * @param begin The start date of the period.
+ * @param end The end date of the period.
+ * @return The calculated interest.
+ */
+template <class Convention>
+long double BaseModel::formula(const Date &begin,
+                               const Date &end) const noexcept {
+  return month_.balance * data_.rate * Convention::yearFraction(begin, end);
+}
+
 }  // namespace s21
 
 #endif  // SRC_INCLUDE_MODEL_BASE_MODEL_H_
@@ -12,39 +12,155 @@
 #ifndef SRC_INCLUDE_MODEL_CALCULATOR_MODEL_H_
 #define SRC_INCLUDE_MODEL_CALCULATOR_MODEL_H_
 
+#include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <iomanip>
-#include <regex>
+#include <memory>
+#include <sstream>
+#include <stack>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace s21 {
 
 /// @brief Class for handling mathematical expressions and evaluating them.
 class CalculatorModel {
  public:
+  /// @brief Enumeration for the instructions of a compiled expression.
+  enum class OpCode : std::uint8_t {
+    NUMBER,
+    VARIABLE,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    MOD,
+    POW,
+    SIN,
+    COS,
+    TAN,
+    ASIN,
+    ACOS,
+    ATAN,
+    LN,
+    LOG,
+    SQRT,
+    NEG
+  };
+
+  /// @brief Structure to hold a single instruction of a compiled expression.
+  struct Instruction {
+    OpCode code;          ///< The operation code.
+    std::uint32_t index;  ///< Index in the constant pool (NUMBER only).
+  };
+
+  /**
+   * @brief Structure to hold an expression compiled to postfix bytecode.
+   *
+   * A program is immutable once compiled and keeps the evaluation state on
+   * the caller's stack, so one program may be shared between threads.
+   */
+  struct Program {
+    long double evaluate(long double x) const;
+    void evaluate_batch(const double *xs, double *out, std::size_t n) const;
+
+    std::vector<Instruction> code;       ///< The postfix instructions.
+    std::vector<long double> constants;  ///< Pre-parsed numeric literals.
+    std::size_t depth{};                 ///< Maximum depth of operand stack.
+    bool valid{false};                   ///< Whether the stack is balanced.
+
+   private:
+    void evaluateBlock(const double *xs, double *out, std::size_t size,
+                       long double *columns) const;
+  };
+
+  /// @brief Enumeration for the types of expression tokens.
+  enum class TokenType {
+    NUMBER,
+    VARIABLE,
+    FUNCTION,
+    OPERATOR,
+    OPEN_BRACKET,
+    CLOSE_BRACKET,
+    INVALID
+  };
+
+  /// @brief Structure to hold a single token of an expression.
+  struct Token {
+    TokenType type;     ///< The token type.
+    OpCode code;        ///< The operation of a function or an operator.
+    long double value;  ///< The value of a number.
+  };
+
+  /// @brief Structure to hold a node of the expression tree.
+  struct Node {
+    Token token;        ///< The operand or operation.
+    std::size_t left;   ///< The index of the left (or only) operand node.
+    std::size_t right;  ///< The index of the right operand node.
+  };
+
   CalculatorModel() = default;
 
-  void add_expression(std::string infix, long double var) noexcept;
-  void to_postfix() noexcept;
+  void add_expression(std::string infix, long double var);
+  void to_postfix();
   bool validate() const noexcept;
-  long double evaluate();
-  std::string evaluate_str();
-  long double &variable() noexcept;
+  long double evaluate() const;
+  void evaluate_batch(const double *xs, double *out, std::size_t n) const;
+  std::string evaluate_str() const;
+  long double variable() const noexcept;
+  void set_variable(long double var) noexcept;
+  const Program &program() const noexcept;
+  std::shared_ptr<const Program> compiled() const noexcept;
+  void set_program(std::shared_ptr<const Program> program,
+                   long double var) noexcept;
 
  private:
-  std::string replaceNames(std::string infix) const noexcept;
-  std::string replaceSubstr(std::string str, const char *from,
-                            const char *to) const;
-  int getPrecedence(char op);
-  bool isFunction(char c) const noexcept;
-  bool isOperator(char c) const noexcept;
+  void tokenize(const std::string &infix);
+  static std::size_t readNumber(const std::string &expr, std::size_t pos,
+                                Token &token);
+  static std::size_t readFunction(const std::string &expr, std::size_t pos,
+                                  Token &token, bool &wrap);
+  void pushToken(const Token &token);
+  void addNode(const Token &token);
+  std::size_t fold(std::size_t index);
+  static bool isNeutral(OpCode code, const Token &operand, bool left) noexcept;
+  bool isOperation(std::size_t index) const noexcept;
+  void emitNode(std::size_t index);
+  void emit(const Token &token);
+  static void calculateColumn(OpCode code, long double *left,
+                              const long double *right, bool *failed,
+                              std::size_t size) noexcept;
+  static void calculateColumn(OpCode code, long double *top, bool *failed,
+                              std::size_t size) noexcept;
+  static OpCode toOpCode(char op) noexcept;
+  static bool isBinary(OpCode code) noexcept;
+  static bool isOperandEnd(TokenType type) noexcept;
+  static int getPrecedence(const Token &token) noexcept;
+  static bool calculate(OpCode code, long double &left,
+                        long double right) noexcept;
+  static bool calculate(OpCode code, long double &top) noexcept;
+  static const char *errorMessage(OpCode code) noexcept;
 
   static constexpr long double kLdoubleMinVal{1.0e-15L};  ///< Minimum value.
+  static constexpr std::size_t kBatchSize{256};     ///< Values per block.
+  static constexpr std::size_t kStackSize{64};      ///< Local stack depth.
+  static constexpr std::size_t kNoChild{SIZE_MAX};  ///< No operand node.
+  static constexpr long double kPi{3.14159265358979323846264338L};  ///< π.
+  static constexpr long double kE{2.71828182845904523536028747L};   ///< e.
 
-  std::string infix_;     ///< The infix expression.
-  std::string postfix_;   ///< The postfix expression.
-  std::size_t size_;      ///< The size of the infix expression.
-  long double variable_;  ///< The variable value.
+  std::vector<Token> tokens_;          ///< The tokens of the expression.
+  long double variable_;               ///< The variable value.
+  std::shared_ptr<const Program> program_{
+      std::make_shared<const Program>()};  ///< The compiled expression.
+  Program compiled_;                   ///< The program on compiling.
+  std::vector<Node> nodes_;            ///< The expression tree on compiling.
+  std::vector<std::size_t> operands_;  ///< Operand subtrees on compiling.
+  std::size_t depth_{};                ///< Current stack depth on compiling.
 };
 
 }  // namespace s21
@@ -12,11 +12,13 @@
 #ifndef SRC_INCLUDE_MODEL_CREDIT_MODEL_H_
 #define SRC_INCLUDE_MODEL_CREDIT_MODEL_H_
 
+#include <algorithm>
 #include <cmath>
 #include <stack>
 #include <string>
 #include <vector>
 
+#include "include/additional/calendar.h"
 #include "include/additional/date.h"
 #include "include/model/base_model.h"
 
@@ -26,15 +28,27 @@ namespace s21 {
 class CreditModel : public BaseModel {
  public:
   CreditModel();
-  ~CreditModel();
 
+  Totals totals() const noexcept override;
+  Totals quote() const noexcept;
   std::vector<std::string> totalTable() const noexcept override;
   void addData(const Data &data) noexcept;
-  void calculatePayments() noexcept override;
+  void calculatePayments() override;
   void clear() noexcept override;
 
  private:
-  void calculatePeriod() noexcept override;
+  template <class Convention>
+  void calculateSchedule();
+  template <class Convention>
+  void calculatePeriod() noexcept;
+  static long double annuity(long double amount, long double monthly_percent,
+                             long double term) noexcept;
+
+  static constexpr std::size_t kCyclePeriods{500};  ///< Periods before the
+                                                    ///< debt cycle check.
+
+  long double rest_{};      ///< Interest carried over to the next period.
+  long double interest_{};  ///< Interest paid in the calculated periods.
 };
 
 }  // namespace s21
@@ -0,0 +1,73 @@
+/**
+ * @file credit_portfolio.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the CreditPortfolio class.
+ * @version 1.0
+ * @date 2024-10-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_MODEL_CREDIT_PORTFOLIO_H_
+#define SRC_INCLUDE_MODEL_CREDIT_PORTFOLIO_H_
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "include/additional/date.h"
+#include "include/additional/day_count.h"
+#include "include/additional/thread_pool.h"
+#include "include/model/credit_model.h"
+
+namespace s21 {
+
+/// @brief Engine calculating the payments of many credits in parallel.
+class CreditPortfolio {
+ public:
+  using Type = CreditModel::Type;
+  using Schedule = CreditModel::Schedule;
+
+  /// @brief Columnar parameters of the credits.
+  struct Loans {
+   public:
+    std::size_t size() const noexcept;
+    void reserve(std::size_t loans);
+    void add(long double amount_, std::size_t term_, long double rate_,
+             Type type_, const Date &date_);
+    CreditModel::Data data(std::size_t index) const noexcept;
+
+    std::vector<long double> amount;  ///< The amounts of the credits.
+    std::vector<std::size_t> term;    ///< The terms in months.
+    std::vector<long double> rate;    ///< The interest rates.
+    std::vector<Type> type;           ///< The types of the credits.
+    std::vector<Date> date;           ///< The start dates.
+    const HolidayCalendar *holidays{};  ///< Business days to pay on, if any.
+    DayCount day_count{DayCount::ACT_ACT_ISDA};  ///< Interest day count.
+  };
+
+  /// @brief Columnar totals of the credits.
+  struct Totals {
+    std::vector<long double> interest;  ///< The interest paid.
+    std::vector<long double> total;     ///< The debt and interest paid.
+  };
+
+  explicit CreditPortfolio(std::size_t threads = 0);
+
+  Totals totals(const Loans &loans);
+  std::vector<Schedule> schedules(const Loans &loans);
+
+ private:
+  using Visitor = std::function<void(CreditModel &, std::size_t)>;
+
+  void calculate(const Loans &loans, const Visitor &visitor);
+
+  static constexpr std::size_t kChunksPerThread{4};  ///< Load balancing.
+
+  ThreadPool pool_;  ///< The workers calculating the credits.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_MODEL_CREDIT_PORTFOLIO_H_
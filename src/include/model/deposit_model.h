@@ -12,10 +12,12 @@
 #ifndef SRC_INCLUDE_MODEL_DEPOSIT_MODEL_H_
 #define SRC_INCLUDE_MODEL_DEPOSIT_MODEL_H_
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
 
+#include "include/additional/calendar.h"
 #include "include/additional/date.h"
 #include "include/model/base_model.h"
 
@@ -53,7 +55,7 @@ class DepositModel : public BaseModel {
     Data(long double amount_, long double term_, TermType term_type_,
          long double rate_, long double tax_rate_, Type type_, Frequency freq_,
          const Date &date_, std::vector<Operation> *ops_ = nullptr);
-    BaseModel::Data *base{};     ///< Pointer to the base data.
+    BaseModel::Data base;        ///< The base data.
     Frequency freq;              ///< The frequency of interest accrual.
     long double tax_rate{};      ///< The tax rate.
     std::vector<Operation> ops;  ///< The list of operations.
@@ -72,28 +74,33 @@ class DepositModel : public BaseModel {
   };
 
   DepositModel();
-  ~DepositModel();
 
   const std::vector<std::vector<std::string>> &taxTable() const noexcept;
+  Totals totals() const noexcept override;
   std::vector<std::string> totalTable() const noexcept override;
   void addData(const Data &data) noexcept;
   void addOperation(const Operation &op) noexcept;
-  void calculatePayments() noexcept override;
+  void calculatePayments() override;
   void clear() noexcept override;
 
  private:
-  void calculatePeriod() noexcept override;
+  template <class Convention>
+  void calculateSchedule();
+  template <class Convention>
+  void calculatePeriod() noexcept;
   Date lastDepositDay() const noexcept;
-  void addPeriod(const Date &last_day) noexcept;
+  std::pmr::vector<Date> paymentDates(const Date &last_day);
   void calculateTaxes(const Date &last_day);
+  template <class Convention>
   void calculateOperations();
   void sortOperations();
   void taxToTable() noexcept;
 
   static constexpr long double kNDFLRate = 0.13L;  ///< The NDFL tax rate.
 
-  Data *data_;  ///< Pointer to the deposit data.
-  Tax *tax_;    ///< Pointer to the tax data.
+  Data data_;              ///< The deposit data.
+  Tax tax_;                ///< The tax data.
+  std::size_t next_op_{};  ///< The first operation not applied yet.
   std::vector<std::vector<std::string>> tax_table_;  ///< Table of tax data.
 };
 
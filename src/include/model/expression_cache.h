@@ -0,0 +1,61 @@
+/**
+ * @file expression_cache.h
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Header file for the ExpressionCache class.
+ * @version 1.0
+ * @date 2024-10-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_INCLUDE_MODEL_EXPRESSION_CACHE_H_
+#define SRC_INCLUDE_MODEL_EXPRESSION_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "include/model/calculator_model.h"
+
+namespace s21 {
+
+/// @brief LRU cache of compiled expressions keyed by the normalized infix.
+class ExpressionCache {
+ public:
+  /// @brief Structure to hold a compiled expression.
+  struct Entry {
+    bool valid{};  ///< The result of the expression validation.
+    std::shared_ptr<const CalculatorModel::Program> program;  ///< Program.
+  };
+
+  explicit ExpressionCache(std::size_t capacity = kDefaultCapacity);
+
+  static std::string normalize(const std::string &infix);
+  const Entry *find(const std::string &key) noexcept;
+  void insert(const std::string &key, const Entry &entry);
+  void clear() noexcept;
+
+  std::size_t size() const noexcept;
+  std::size_t capacity() const noexcept;
+  std::size_t hits() const noexcept;
+  std::size_t misses() const noexcept;
+
+ private:
+  using Item = std::pair<std::string, Entry>;  ///< Key and compiled entry.
+
+  static constexpr std::size_t kDefaultCapacity{512};  ///< Default capacity.
+
+  std::size_t capacity_;  ///< The maximum number of entries.
+  std::size_t hits_{};    ///< The number of successful lookups.
+  std::size_t misses_{};  ///< The number of failed lookups.
+  std::list<Item> items_;  ///< Entries from the most to least recently used.
+  std::unordered_map<std::string, std::list<Item>::iterator>
+      index_;  ///< Entries by key.
+};
+
+}  // namespace s21
+
+#endif  // SRC_INCLUDE_MODEL_EXPRESSION_CACHE_H_
@@ -13,11 +13,25 @@
 
 namespace s21 {
 
-/// @brief Constructs a BaseModel object.
-BaseModel::BaseModel() : month_{new Month} {}
+namespace {
+
+/// @brief Clears the receiver of the streamed rows when leaving the scope.
+class RowsGuard {
+ public:
+  explicit RowsGuard(const BaseModel::RowCallback *&rows) noexcept
+      : rows_{rows} {}
+  RowsGuard(const RowsGuard &other) = delete;
+  RowsGuard &operator=(const RowsGuard &other) = delete;
+  ~RowsGuard() { rows_ = nullptr; }
 
-/// @brief Destructs the BaseModel object.
-BaseModel::~BaseModel() { delete month_; }
+ private:
+  const BaseModel::RowCallback *&rows_;  ///< The receiver to clear.
+};
+
+}  // namespace
+
+/// @brief Constructs a BaseModel object.
+BaseModel::BaseModel() : arena_{arena_buffer_, kArenaSize} {}
 
 /**
  * @brief Constructs a Data object with the given parameters.
@@ -39,27 +53,130 @@ BaseModel::Data::Data(long double amount_, long double term_,
       date{date_} {}
 
 /**
- * @brief Returns the table of payments.
- * @return A constant reference to the table of payments.
+ * @brief Returns the number of rows in the schedule.
+ * @return The number of rows.
+ */
+std::size_t BaseModel::Schedule::size() const noexcept { return dates.size(); }
+
+/// @brief Removes all rows from the schedule.
+void BaseModel::Schedule::clear() noexcept {
+  dates.clear();
+  percent.clear();
+  main.clear();
+  summary.clear();
+  balance.clear();
+}
+
+/**
+ * @brief Reserves memory for the rows of the schedule.
+ * @param rows The expected number of rows.
+ */
+void BaseModel::Schedule::reserve(std::size_t rows) {
+  dates.reserve(rows);
+  percent.reserve(rows);
+  main.reserve(rows);
+  summary.reserve(rows);
+  balance.reserve(rows);
+}
+
+/**
+ * @brief Appends a month's data to the schedule.
+ * @param month The monthly payment data.
+ */
+void BaseModel::Schedule::push_back(const Month &month) {
+  dates.push_back(month.current);
+  percent.push_back(month.percent);
+  main.push_back(month.main);
+  summary.push_back(month.summary);
+  balance.push_back(month.balance);
+}
+
+/**
+ * @brief Formats a row of the schedule.
+ * @param index The index of the row.
+ * @return The date, interest, main part, payment and balance as strings.
+ */
+std::vector<std::string> BaseModel::Schedule::row(std::size_t index) const {
+  return {dates[index].currentDate(), toStr(percent[index]),
+          toStr(main[index]), toStr(summary[index]), toStr(balance[index])};
+}
+
+/**
+ * @brief Returns the schedule of payments.
+ * @return A constant reference to the schedule of payments.
+ */
+const BaseModel::Schedule &BaseModel::schedule() const noexcept {
+  return schedule_;
+}
+
+/**
+ * @brief Formats the schedule of payments as a table of strings.
+ * @return The table of payments.
  */
-const std::vector<std::vector<std::string>> &BaseModel::table() const noexcept {
-  return table_;
+std::vector<std::vector<std::string>> BaseModel::table() const {
+  std::vector<std::vector<std::string>> table;
+
+  table.reserve(schedule_.size());
+
+  for (std::size_t i{}; i < schedule_.size(); ++i) {
+    table.push_back(schedule_.row(i));
+  }
+
+  return table;
 }
 
 /**
- * @brief Calculates the interest for a given period.
- * @param begin The start date of the period.
- * @param end The end date of the period.
- * @return The calculated interest.
+ * @brief Calculates the payments without building the tables.
+ *
+ * Replaces calculatePayments for callers that need only the totals.
+ * @return The totals of the payments.
  */
-long double BaseModel::formula(const Date &begin, const Date &end) noexcept {
-  std::pair<std::size_t, std::size_t> days{begin.leapDaysBetween(end)};
+BaseModel::Totals BaseModel::calculateTotals() noexcept {
+  summary_ = true;
+  calculatePayments();
+  summary_ = false;
 
-  long double base_sum = month_->balance * data_->rate;
-  long double default_sum = base_sum / Date::kYearDays * days.first;
-  long double leap_sum = base_sum / Date::kLeapYearDays * days.second;
+  return totals();
+}
 
-  return default_sum + leap_sum;
+/**
+ * @brief Calculates the payments passing every row to the callback.
+ *
+ * The rows are not stored in the schedule, so the memory does not grow with
+ * the number of periods. Every call streams the same rows for the same data.
+ * An exception thrown by the callback stops the calculation and propagates
+ * to the caller, and the model can be calculated again afterwards.
+ * @param callback The receiver of the rows.
+ * @return The totals of the payments.
+ */
+BaseModel::Totals BaseModel::streamPayments(const RowCallback &callback) {
+  {
+    RowsGuard guard{rows_};
+    rows_ = &callback;
+    calculatePayments();
+  }
+
+  return totals();
+}
+
+/**
+ * @brief Sets the calendar of the business days to pay on.
+ *
+ * Applies to the next calculation without adding the data again.
+ * @param holidays The calendar, or nullptr to pay on the nominal dates.
+ */
+void BaseModel::setHolidays(const HolidayCalendar *holidays) noexcept {
+  data_.holidays = holidays;
+}
+
+/**
+ * @brief Sets the day count convention of the interest.
+ *
+ * Applies to the next calculation without adding the data again.
+ * @param convention The day count convention.
+ */
+void BaseModel::setDayCount(DayCount convention) noexcept {
+  data_.day_count = convention;
 }
 
 /**
@@ -85,18 +202,36 @@ std::string BaseModel::toStr(long double val) noexcept {
 }
 
 /**
- * @brief Adds a month's data to the table.
+ * @brief Passes a month's data to the streamed rows or to the schedule.
  */
-void BaseModel::monthToTable() noexcept {
-  std::vector<std::string> str_month;
+void BaseModel::monthToTable() {
+  if (rows_) {
+    (*rows_)(month_);
+  } else if (!summary_) {
+    schedule_.push_back(month_);
+  }
+}
 
-  str_month.emplace_back(month_->current.currentDate());
-  str_month.emplace_back(toStr(month_->percent));
-  str_month.emplace_back(toStr(month_->main));
-  str_month.emplace_back(toStr(month_->summary));
-  str_month.emplace_back(toStr(month_->balance));
+/**
+ * @brief Releases the arena and returns it for a new calculation.
+ *
+ * Every call invalidates the std::pmr::vector objects allocated from the
+ * arena before it, so a calculation takes its scratch once, before its
+ * first pmr vector. The arena only holds the payment dates. The monotonic
+ * arena does not reuse the memory freed by a reallocation, so the dates are
+ * reserved up front, and longer schedules spill over to the heap.
+ * @return The arena of the calculation.
+ */
+std::pmr::memory_resource *BaseModel::scratch() noexcept {
+  arena_.release();
 
-  table_.emplace_back(str_month);
+  return &arena_;
 }
 
+/**
+ * @brief Checks whether the calculated rows are stored in the schedule.
+ * @return True unless only totals are calculated or the rows are streamed.
+ */
+bool BaseModel::storesSchedule() const noexcept { return !summary_ && !rows_; }
+
 }  // namespace s21
@@ -18,383 +18,855 @@ namespace s21 {
  * @param infix The infix expression.
  * @param var The variable value.
  */
-void CalculatorModel::add_expression(std::string infix,
-                                     long double var) noexcept {
+void CalculatorModel::add_expression(std::string infix, long double var) {
   variable_ = var;
-  postfix_ = std::string{};
-  infix_ = replaceNames(infix);
+  program_ = std::make_shared<const Program>();
+  tokenize(infix);
 }
 
 /**
- * @brief Returns a reference to the variable value.
- * @return A reference to the variable value.
+ * @brief Returns the variable value.
+ * @return The variable value.
  */
-long double &CalculatorModel::variable() noexcept { return variable_; }
+long double CalculatorModel::variable() const noexcept { return variable_; }
 
-/// @brief Converts the infix expression to postfix notation.
-void CalculatorModel::to_postfix() noexcept {
-  std::stack<char> ops;
-  size_ = infix_.size();
+/**
+ * @brief Sets the variable value.
+ * @param var The variable value.
+ */
+void CalculatorModel::set_variable(long double var) noexcept {
+  variable_ = var;
+}
+
+/**
+ * @brief Returns the compiled postfix program.
+ * @return A constant reference to the compiled program.
+ */
+const CalculatorModel::Program &CalculatorModel::program() const noexcept {
+  return *program_;
+}
 
-  for (std::size_t i{}; i < size_; ++i) {
-    char c = infix_[i];
+/**
+ * @brief Returns the shared compiled program.
+ * @return A shared pointer to the compiled program.
+ */
+std::shared_ptr<const CalculatorModel::Program> CalculatorModel::compiled()
+    const noexcept {
+  return program_;
+}
 
-    if (isdigit(c) || c == 'x') {
-      std::string num;
+/**
+ * @brief Sets an already compiled program instead of an expression.
+ * @param program The compiled program.
+ * @param var The variable value.
+ */
+void CalculatorModel::set_program(std::shared_ptr<const Program> program,
+                                  long double var) noexcept {
+  variable_ = var;
+  program_ = std::move(program);
+}
 
-      bool science{false};
-      while (i < size_ &&
-             (isdigit(infix_[i]) || infix_[i] == '.' || infix_[i] == 'e' ||
-              (science && (infix_[i] == '+' || infix_[i] == '-')) ||
-              infix_[i] == 'x')) {
-        num += infix_[i];
-        ++i;
+/**
+ * @brief Splits the infix expression into typed tokens in a single pass.
+ *
+ * Constants are replaced with their values, a run of unary signs becomes
+ * one negation if it has an odd number of minuses, and implicit
+ * multiplications are inserted between adjacent operands.
+ * @param infix The infix expression.
+ */
+void CalculatorModel::tokenize(const std::string &infix) {
+  std::string expr;
+  bool wrap{false};
 
-        if (i < size_ && infix_[i] == 'e') {
-          science = true;
-        }
-      }
+  for (auto i : infix) {
+    if (i != ' ') expr += i;
+  }
 
-      postfix_ += num + ' ';
-      --i;
+  tokens_.clear();
+
+  for (std::size_t i{}, length{1}; i < expr.size(); i += length) {
+    Token token{TokenType::INVALID, OpCode::NUMBER, 0.0L};
+    char c{expr[i]};
+    length = 1;
+
+    if (isdigit(c) || c == '.') {
+      length = readNumber(expr, i, token);
+    } else if (c == 'x') {
+      token = {TokenType::VARIABLE, OpCode::VARIABLE, 0.0L};
+    } else if (c == 'P' || !expr.compare(i, 2, "π")) {
+      token = {TokenType::NUMBER, OpCode::NUMBER, kPi};
+      length = (c == 'P') ? 1 : 2;
+    } else if (c == 'e') {
+      token = {TokenType::NUMBER, OpCode::NUMBER, kE};
     } else if (c == '(') {
-      ops.push(c);
+      token.type = TokenType::OPEN_BRACKET;
     } else if (c == ')') {
-      while (!ops.empty() && ops.top() != '(') {
-        postfix_ += ops.top();
-        postfix_ += ' ';
-        ops.pop();
+      token.type = TokenType::CLOSE_BRACKET;
+    } else if ((c == '-' || c == '+') &&
+               (tokens_.empty() ||
+                tokens_.back().type == TokenType::OPEN_BRACKET)) {
+      bool negative{false};
+
+      for (length = 0; i + length < expr.size() &&
+                       (expr[i + length] == '-' || expr[i + length] == '+');
+           ++length) {
+        negative = negative != (expr[i + length] == '-');
       }
 
-      if (!ops.empty() && isFunction(ops.top())) {
-        postfix_ += ops.top();
-        postfix_ += ' ';
+      if (!negative) continue;
+
+      if (tokens_.empty()) {
+        token = {TokenType::FUNCTION, OpCode::NEG, 0.0L};
+      } else {
+        tokens_.push_back({TokenType::NUMBER, OpCode::NUMBER, -1.0L});
+        token = {TokenType::OPERATOR, OpCode::MUL, 0.0L};
+      }
+    } else if (!expr.compare(i, 3, "mod")) {
+      token = {TokenType::OPERATOR, OpCode::MOD, 0.0L};
+      length = 3;
+    } else if (std::string{"+-*/^"}.find(c) != std::string::npos) {
+      token = {TokenType::OPERATOR, toOpCode(c), 0.0L};
+    } else {
+      length = readFunction(expr, i, token, wrap);
+    }
+
+    pushToken(token);
+
+    if (wrap && token.type == TokenType::FUNCTION) {
+      pushToken({TokenType::OPEN_BRACKET, OpCode::NUMBER, 0.0L});
+    } else if (wrap) {
+      pushToken({TokenType::CLOSE_BRACKET, OpCode::NUMBER, 0.0L});
+      wrap = false;
+    }
+  }
+}
+
+/**
+ * @brief Reads a number literal, including the scientific notation.
+ * @param expr The expression without spaces.
+ * @param pos The position of the first character of the number.
+ * @param token The token to fill.
+ * @return The length of the number literal.
+ */
+std::size_t CalculatorModel::readNumber(const std::string &expr,
+                                        std::size_t pos, Token &token) {
+  std::size_t size{expr.size()};
+  std::size_t end{pos};
+  std::size_t dots{};
+
+  for (; end < size && (isdigit(expr[end]) || expr[end] == '.'); ++end) {
+    if (expr[end] == '.') ++dots;
+  }
+
+  if (end < size && (expr[end] == 'e' || expr[end] == 'E') &&
+      isdigit(expr[end - 1])) {
+    std::size_t exp{end + 1};
+
+    if (exp < size && (expr[exp] == '+' || expr[exp] == '-')) ++exp;
+
+    if (exp < size && isdigit(expr[exp])) {
+      for (end = exp; end < size && isdigit(expr[end]); ++end) {
+      }
+    }
+  }
+
+  auto [ptr, ec] =
+      std::from_chars(expr.data() + pos, expr.data() + end, token.value);
+
+  if (dots < 2 && ec == std::errc{} && ptr == expr.data() + end) {
+    token.type = TokenType::NUMBER;
+  }
+
+  return end - pos;
+}
+
+/**
+ * @brief Reads a function name.
+ *
+ * A function must be followed by a bracket, or directly by the variable or
+ * π, in which case the argument is wrapped into brackets.
+ * @param expr The expression without spaces.
+ * @param pos The position of the first character of the name.
+ * @param token The token to fill.
+ * @param wrap Set if the argument of the function has no brackets.
+ * @return The length of the function name.
+ */
+std::size_t CalculatorModel::readFunction(const std::string &expr,
+                                          std::size_t pos, Token &token,
+                                          bool &wrap) {
+  static const std::pair<const char *, OpCode> kFunctions[]{
+      {"asin", OpCode::ASIN}, {"acos", OpCode::ACOS}, {"atan", OpCode::ATAN},
+      {"sqrt", OpCode::SQRT}, {"sin", OpCode::SIN},   {"cos", OpCode::COS},
+      {"tan", OpCode::TAN},   {"log", OpCode::LOG},   {"ln", OpCode::LN}};
+  std::size_t length{1};
+
+  for (const auto &[name, code] : kFunctions) {
+    std::size_t name_size{std::char_traits<char>::length(name)};
+
+    if (!expr.compare(pos, name_size, name)) {
+      std::size_t next{pos + name_size};
+      length = name_size;
+
+      if (next < expr.size() && expr[next] == '(') {
+        token = {TokenType::FUNCTION, code, 0.0L};
+      } else if (next < expr.size() &&
+                 (expr[next] == 'x' || expr[next] == 'P' ||
+                  !expr.compare(next, 2, "π"))) {
+        token = {TokenType::FUNCTION, code, 0.0L};
+        wrap = true;
+      }
+
+      break;
+    }
+  }
+
+  return length;
+}
+
+/**
+ * @brief Appends a token, inserting an implicit multiplication if needed.
+ * @param token The token to append.
+ */
+void CalculatorModel::pushToken(const Token &token) {
+  bool starts_operand{token.type == TokenType::NUMBER ||
+                      token.type == TokenType::VARIABLE ||
+                      token.type == TokenType::FUNCTION ||
+                      token.type == TokenType::OPEN_BRACKET};
+
+  if (starts_operand && !tokens_.empty() &&
+      isOperandEnd(tokens_.back().type)) {
+    tokens_.push_back({TokenType::OPERATOR, OpCode::MUL, 0.0L});
+  }
+
+  tokens_.push_back(token);
+}
+
+/**
+ * @brief Compiles the token stream to postfix bytecode.
+ *
+ * The shunting-yard output is collected into an expression tree, where
+ * subtrees without the variable are folded into constants, and the tree is
+ * emitted as the program.
+ */
+void CalculatorModel::to_postfix() {
+  std::stack<Token> ops;
+  compiled_ = Program{};
+  compiled_.valid = true;
+  nodes_.clear();
+  operands_.clear();
+
+  for (const Token &token : tokens_) {
+    if (token.type == TokenType::NUMBER || token.type == TokenType::VARIABLE) {
+      addNode(token);
+    } else if (token.type == TokenType::OPEN_BRACKET ||
+               token.type == TokenType::FUNCTION) {
+      ops.push(token);
+    } else if (token.type == TokenType::CLOSE_BRACKET) {
+      while (!ops.empty() && ops.top().type != TokenType::OPEN_BRACKET) {
+        addNode(ops.top());
+        ops.pop();
       }
 
       if (ops.size()) {
         ops.pop();
       }
-    } else if (isOperator(c) || isFunction(c)) {
+    } else if (token.type == TokenType::OPERATOR) {
+      int precedence{getPrecedence(token)};
+
       while (!ops.empty() &&
-             ((c != '^' && getPrecedence(ops.top()) >= getPrecedence(c)) ||
-              (c == '^' && getPrecedence(ops.top()) > getPrecedence(c)))) {
-        postfix_ += ops.top();
-        postfix_ += ' ';
+             ((token.code != OpCode::POW &&
+               getPrecedence(ops.top()) >= precedence) ||
+              (token.code == OpCode::POW &&
+               getPrecedence(ops.top()) > precedence))) {
+        addNode(ops.top());
         ops.pop();
       }
 
-      ops.push(c);
+      ops.push(token);
     }
   }
 
   while (!ops.empty()) {
-    postfix_ += ops.top();
-    postfix_ += ' ';
+    addNode(ops.top());
     ops.pop();
   }
+
+  if (!compiled_.valid || operands_.empty()) {
+    compiled_.valid = false;
+  } else {
+    depth_ = 0;
+    emitNode(operands_.back());
+  }
+
+  program_ = std::make_shared<const Program>(std::move(compiled_));
 }
 
 /**
- * @brief Validates the infix expression.
- * @return True if the expression is valid, false otherwise.
+ * @brief Adds a shunting-yard output token to the expression tree.
+ * @param token The operand or operation token.
  */
-bool CalculatorModel::validate() const noexcept {
-  const std::string valid_chars{"()^+-*/msctSCTQLlPxe1234567890."};
-  std::size_t open_br{};
-  std::size_t close_br{};
-  bool valid{(infix_.size()) ? true : false};
-  bool in_number{false};
-  std::size_t dot_count{};
-  char ch;
+void CalculatorModel::addNode(const Token &token) {
+  Node node{token, kNoChild, kNoChild};
 
-  for (std::size_t i = 0; i < infix_.size() && valid; ++i) {
-    ch = infix_[i];
+  if (token.type == TokenType::OPERATOR || token.type == TokenType::FUNCTION) {
+    std::size_t arity{isBinary(token.code) ? 2U : 1U};
 
-    if (ch == '(') {
-      ++open_br;
-    } else if (ch == ')') {
-      ++close_br;
+    if (operands_.size() < arity) {
+      compiled_.valid = false;
+      return;
     }
 
-    if (valid_chars.find(infix_[i]) == std::string::npos) {
-      valid = false;
-    } else if (isOperator(ch) &&
-               (isOperator(infix_[i + 1]) || infix_[i + 1] == ')')) {
-      valid = false;
-    } else if (close_br > open_br) {
-      valid = false;
-    } else if (isFunction(ch) && ch != 'P') {
-      if (infix_[i + 1] != '(') {
-        valid = false;
-      }
+    if (arity == 2) {
+      node.right = operands_.back();
+      operands_.pop_back();
     }
 
-    if (isdigit(ch) || ch == '.') {
-      if (!in_number) {
-        in_number = true;
-        dot_count = 0;
-      }
+    node.left = operands_.back();
+    operands_.pop_back();
+  } else if (token.type != TokenType::NUMBER &&
+             token.type != TokenType::VARIABLE) {
+    return;
+  }
 
-      if (ch == '.') {
-        ++dot_count;
+  nodes_.push_back(node);
+  operands_.push_back(fold(nodes_.size() - 1));
+}
 
-        if (dot_count > 1) {
-          valid = false;
-        }
+/**
+ * @brief Folds a node with constant operands and drops neutral operands.
+ *
+ * Operations that fail on constants are kept, so the error is reported on
+ * evaluation. Neutral operands are dropped only next to another operation,
+ * whose result is already rounded to zero like the dropped one would be.
+ * @param index The index of the node.
+ * @return The index of the node replacing the subtree.
+ */
+std::size_t CalculatorModel::fold(std::size_t index) {
+  Node &node{nodes_[index]};
+  Token &token{node.token};
+
+  if (token.type == TokenType::NUMBER || token.type == TokenType::VARIABLE) {
+    return index;
+  }
+
+  const Token &left{nodes_[node.left].token};
+  long double value{left.value};
+  std::size_t result{index};
+
+  if (node.right == kNoChild) {
+    if (left.type == TokenType::NUMBER && calculate(token.code, value)) {
+      node = Node{
+          {TokenType::NUMBER, OpCode::NUMBER, value}, kNoChild, kNoChild};
+    } else if (token.code == OpCode::NEG && left.code == OpCode::NEG &&
+               isOperation(nodes_[node.left].left)) {
+      result = nodes_[node.left].left;
+    }
+  } else {
+    const Token &right{nodes_[node.right].token};
+
+    if (left.type == TokenType::NUMBER && right.type == TokenType::NUMBER) {
+      if (calculate(token.code, value, right.value)) {
+        node = Node{{TokenType::NUMBER, OpCode::NUMBER, value}, kNoChild,
+                    kNoChild};
       }
-    } else {
-      in_number = false;
+    } else if (isNeutral(token.code, right, false) && isOperation(node.left)) {
+      result = node.left;
+    } else if (isNeutral(token.code, left, true) && isOperation(node.right)) {
+      result = node.right;
     }
   }
 
-  if (open_br != close_br) {
-    valid = false;
-  }
+  return result;
+}
 
-  if (infix_.find("()") != std::string::npos) {
-    valid = false;
+/**
+ * @brief Checks if an operand does not change the result of an operator.
+ * @param code The operator.
+ * @param operand The operand token.
+ * @param left Whether the operand is on the left side.
+ * @return True for x+0, 0+x, x-0, x*1, 1*x, x/1 and x^1.
+ */
+bool CalculatorModel::isNeutral(OpCode code, const Token &operand,
+                                bool left) noexcept {
+  bool neutral{false};
+
+  if (operand.type == TokenType::NUMBER) {
+    if (code == OpCode::ADD || (code == OpCode::SUB && !left)) {
+      neutral = operand.value == 0.0L;
+    } else if (code == OpCode::MUL ||
+               (!left && (code == OpCode::DIV || code == OpCode::POW))) {
+      neutral = operand.value == 1.0L;
+    }
   }
 
-  return valid;
+  return neutral;
 }
 
 /**
- * @brief Evaluates the postfix expression.
- * @return The result of the evaluation.
+ * @brief Checks if a node of the expression tree is an operation.
+ * @param index The index of the node.
+ * @return True for operators and functions.
  */
-long double CalculatorModel::evaluate() {
-  std::stack<long double> operands;
-  std::istringstream iss{postfix_};
-  std::string token;
-
-  while (iss >> token) {
-    if (isdigit(token[0]) ||
-        (token[0] == '.' && token.size() && isdigit(token[1])) ||
-        token == "x") {
-      if (token == "x") {
-        operands.push(variable_);
-      } else {
-        operands.push(std::stold(token));
-      }
-    } else if (isOperator(token[0])) {
-      long double right = operands.top();
-      operands.pop();
-      long double left = operands.top();
-      operands.pop();
-
-      switch (token[0]) {
-        case '+':
-          left += right;
-          break;
-        case '-':
-          left -= right;
-          break;
-        case '*':
-          left *= right;
-          break;
-        case '/':
-          if (!right) throw std::invalid_argument("divide to zero");
-          left /= right;
-          break;
-        case 'm':
-          left = std::fmod(left, right);
-          if (left < 0) left += right;
-          break;
-        case '^':
-          left = std::pow(left, right);
-          break;
-      }
+bool CalculatorModel::isOperation(std::size_t index) const noexcept {
+  TokenType type{nodes_[index].token.type};
 
-      operands.push((std::fabs(left) > kLdoubleMinVal) ? left : 0.0L);
-    } else if (isFunction(token[0])) {
-      long double top = operands.top();
-      operands.pop();
-
-      switch (token[0]) {
-        case 's':
-          top = std::sin(top);
-          break;
-        case 'c':
-          top = std::cos(top);
-          break;
-        case 't':
-          top = std::tan(top);
-          break;
-        case 'S':
-          if (std::fabs(top) > 1.0L)
-            throw std::invalid_argument("asin: wrong range");
-          top = std::asin(top);
-          break;
-        case 'C':
-          if (std::fabs(top) > 1.0L)
-            throw std::invalid_argument("acos: wrong range");
-          top = std::acos(top);
-          break;
-        case 'T':
-          top = std::atan(top);
-          break;
-        case 'l':
-          if (top < 0.0L) throw std::invalid_argument("ln: negative number");
-          top = std::log(top);
-          break;
-        case 'L':
-          if (top < 0.0L) throw std::invalid_argument("log: negative number");
-          top = std::log10(top);
-          break;
-        case 'Q':
-          if (top < 0.0L) throw std::invalid_argument("sqrt: negative number");
-          top = std::sqrt(top);
-          break;
-        case 'P':
-          top *= -1.0L;
-      }
+  return type == TokenType::OPERATOR || type == TokenType::FUNCTION;
+}
 
-      operands.push((std::fabs(top) > kLdoubleMinVal) ? top : 0.0L);
+/**
+ * @brief Emits a subtree of the expression tree in postfix order.
+ *
+ * The tree is walked with an explicit stack, so a deeply nested expression
+ * cannot overflow the call stack.
+ * @param index The index of the subtree root.
+ */
+void CalculatorModel::emitNode(std::size_t index) {
+  std::vector<std::pair<std::size_t, bool>> pending{{index, false}};
+
+  while (!pending.empty()) {
+    auto [current, visited] = pending.back();
+    const Node &node{nodes_[current]};
+    pending.pop_back();
+
+    if (visited) {
+      emit(node.token);
+    } else {
+      pending.push_back({current, true});
+
+      if (node.right != kNoChild) pending.push_back({node.right, false});
+      if (node.left != kNoChild) pending.push_back({node.left, false});
     }
   }
+}
 
-  return operands.top();
+/**
+ * @brief Appends an operand or an operation to the compiled program.
+ * @param token The token to compile.
+ */
+void CalculatorModel::emit(const Token &token) {
+  if (token.type == TokenType::NUMBER) {
+    compiled_.code.push_back(
+        {OpCode::NUMBER,
+         static_cast<std::uint32_t>(compiled_.constants.size())});
+    compiled_.constants.push_back(token.value);
+  } else if (token.type == TokenType::VARIABLE) {
+    compiled_.code.push_back({OpCode::VARIABLE, 0});
+  } else {
+    depth_ -= isBinary(token.code) ? 2U : 1U;
+    compiled_.code.push_back({token.code, 0});
+  }
+
+  if (++depth_ > compiled_.depth) {
+    compiled_.depth = depth_;
+  }
 }
 
 /**
- * @brief Evaluates the postfix expression and returns the result as a string.
- * @return The result of the evaluation as a string.
+ * @brief Validates the token stream of the infix expression.
+ * @return True if the expression is valid, false otherwise.
  */
-std::string CalculatorModel::evaluate_str() {
-  std::ostringstream stream;
-  long double result{evaluate()};
-  stream << std::fixed << std::setprecision(7) << result;
-  std::string result_str{stream.str()};
+bool CalculatorModel::validate() const noexcept {
+  bool valid{!tokens_.empty()};
+  std::size_t open_br{};
+  TokenType prev{TokenType::OPERATOR};
 
-  while (result_str.back() == '0' || result_str.back() == '.') {
-    result_str.pop_back();
+  for (std::size_t i{}; i < tokens_.size() && valid; ++i) {
+    TokenType type{tokens_[i].type};
+
+    if (type == TokenType::INVALID) {
+      valid = false;
+    } else if (type == TokenType::OPERATOR) {
+      valid = isOperandEnd(prev);
+    } else if (type == TokenType::CLOSE_BRACKET) {
+      valid = isOperandEnd(prev) && open_br;
+      --open_br;
+    } else if (type == TokenType::OPEN_BRACKET) {
+      ++open_br;
+    }
+
+    prev = type;
   }
 
-  return result_str;
+  return valid && !open_br && isOperandEnd(prev);
+}
+
+/**
+ * @brief Evaluates the compiled postfix program.
+ * @return The result of the evaluation.
+ * @throws std::invalid_argument if the expression is malformed or a value is
+ * out of the function domain.
+ */
+long double CalculatorModel::evaluate() const {
+  return program_->evaluate(variable_);
 }
 
 /**
- * @brief Replaces substrings in the given string.
- * @param str The input string.
- * @param from The substring to replace.
- * @param to The substring to replace with.
- * @return The modified string.
+ * @brief Evaluates the compiled postfix program for an array of variables.
+ * @param xs The variable values.
+ * @param out The results, NaN where a value is out of the function domain.
+ * @param n The number of values.
+ * @throws std::invalid_argument if the expression is malformed.
+ */
+void CalculatorModel::evaluate_batch(const double *xs, double *out,
+                                     std::size_t n) const {
+  program_->evaluate_batch(xs, out, n);
+}
+
+/**
+ * @brief Evaluates the program for a variable value.
+ *
+ * The operand stack lives on the caller's stack, so the call is reentrant.
+ * @param x The variable value.
+ * @return The result of the evaluation.
+ * @throws std::invalid_argument if the expression is malformed or a value is
+ * out of the function domain.
  */
-std::string CalculatorModel::replaceSubstr(std::string str, const char *from,
-                                           const char *to) const {
-  std::string from_{from};
-  std::string to_{to};
-  size_t start_pos{};
+long double CalculatorModel::Program::evaluate(long double x) const {
+  if (!valid) throw std::invalid_argument("invalid expression");
 
-  while ((start_pos = str.find(from, start_pos)) != std::string::npos) {
-    str.replace(start_pos, from_.length(), to);
-    start_pos += to_.length();
+  long double local[kStackSize];
+  std::vector<long double> heap;
+  long double *top{local};
+
+  if (depth > kStackSize) {
+    heap.resize(depth);
+    top = heap.data();
   }
 
-  return str;
+  for (const Instruction &ins : code) {
+    switch (ins.code) {
+      case OpCode::NUMBER:
+        *top++ = constants[ins.index];
+        break;
+      case OpCode::VARIABLE:
+        *top++ = x;
+        break;
+      case OpCode::ADD:
+      case OpCode::SUB:
+      case OpCode::MUL:
+      case OpCode::DIV:
+      case OpCode::MOD:
+      case OpCode::POW:
+        --top;
+        if (!calculate(ins.code, top[-1], *top)) {
+          throw std::invalid_argument(errorMessage(ins.code));
+        }
+        break;
+      default:
+        if (!calculate(ins.code, top[-1])) {
+          throw std::invalid_argument(errorMessage(ins.code));
+        }
+    }
+  }
+
+  return top[-1];
 }
 
 /**
- * @brief Replaces variable names in the infix expression.
- * @param infix The infix expression.
- * @return The modified infix expression.
+ * @brief Evaluates the program for an array of variables.
+ * @param xs The variable values.
+ * @param out The results, NaN where a value is out of the function domain.
+ * @param n The number of values.
+ * @throws std::invalid_argument if the expression is malformed.
  */
-std::string CalculatorModel::replaceNames(std::string infix) const noexcept {
-  std::string result;
+void CalculatorModel::Program::evaluate_batch(const double *xs, double *out,
+                                              std::size_t n) const {
+  if (!valid) throw std::invalid_argument("invalid expression");
 
-  for (auto i : infix) {
-    if (i != ' ') result += i;
+  std::vector<long double> columns(depth * kBatchSize);
+
+  for (std::size_t begin{}; begin < n; begin += kBatchSize) {
+    evaluateBlock(xs + begin, out + begin, std::min(kBatchSize, n - begin),
+                  columns.data());
+  }
+}
+
+/**
+ * @brief Evaluates one block of a batch column by column.
+ * @param xs The variable values.
+ * @param out The results.
+ * @param size The number of values, at most kBatchSize.
+ * @param columns The operand columns, depth * kBatchSize values.
+ */
+void CalculatorModel::Program::evaluateBlock(const double *xs, double *out,
+                                             std::size_t size,
+                                             long double *columns) const {
+  long double *top{columns};
+  bool failed[kBatchSize]{};
+
+  for (const Instruction &ins : code) {
+    switch (ins.code) {
+      case OpCode::NUMBER:
+        std::fill_n(top, size, constants[ins.index]);
+        top += kBatchSize;
+        break;
+      case OpCode::VARIABLE:
+        std::copy_n(xs, size, top);
+        top += kBatchSize;
+        break;
+      case OpCode::ADD:
+      case OpCode::SUB:
+      case OpCode::MUL:
+      case OpCode::DIV:
+      case OpCode::MOD:
+      case OpCode::POW:
+        top -= kBatchSize;
+        calculateColumn(ins.code, top - kBatchSize, top, failed, size);
+        break;
+      default:
+        calculateColumn(ins.code, top - kBatchSize, failed, size);
+    }
   }
 
-  result = replaceSubstr(result, "π", "P");
+  top -= kBatchSize;
 
-  std::regex number_x_pattern{"(\\d+)x"};
-  result = std::regex_replace(result, number_x_pattern, "$1*x");
+  for (std::size_t i{}; i < size; ++i) {
+    out[i] = failed[i] ? std::nan("") : static_cast<double>(top[i]);
+  }
+}
 
-  std::regex x_number_pattern{"x(\\d+)"};
-  result = std::regex_replace(result, x_number_pattern, "x*$1");
+/**
+ * @brief Applies a binary operator to columns of operands.
+ * @param code The operator.
+ * @param left The left operands, replaced with the results.
+ * @param right The right operands.
+ * @param failed The flags of values out of the operator domain.
+ * @param size The number of values.
+ */
+void CalculatorModel::calculateColumn(OpCode code, long double *left,
+                                      const long double *right, bool *failed,
+                                      std::size_t size) noexcept {
+  switch (code) {
+    case OpCode::ADD:
+      for (std::size_t i{}; i < size; ++i) left[i] += right[i];
+      break;
+    case OpCode::SUB:
+      for (std::size_t i{}; i < size; ++i) left[i] -= right[i];
+      break;
+    case OpCode::MUL:
+      for (std::size_t i{}; i < size; ++i) left[i] *= right[i];
+      break;
+    default:
+      for (std::size_t i{}; i < size; ++i) {
+        if (!calculate(code, left[i], right[i])) failed[i] = true;
+      }
+      return;
+  }
 
-  std::regex number_e_pattern{"(\\d+)e(\\d+|[+-])"};
-  result = std::regex_replace(result, number_e_pattern, "$1E$2");
+  for (std::size_t i{}; i < size; ++i) {
+    left[i] = (std::fabs(left[i]) > kLdoubleMinVal) ? left[i] : 0.0L;
+  }
+}
 
-  result = replaceSubstr(result, "x", "(x)");
-  result = replaceSubstr(result, "P", "(3.1415926535897932384626433)");
+/**
+ * @brief Applies a function to a column of operands.
+ * @param code The function.
+ * @param top The operands, replaced with the results.
+ * @param failed The flags of values out of the function domain.
+ * @param size The number of values.
+ */
+void CalculatorModel::calculateColumn(OpCode code, long double *top,
+                                      bool *failed, std::size_t size) noexcept {
+  for (std::size_t i{}; i < size; ++i) {
+    if (!calculate(code, top[i])) failed[i] = true;
+  }
+}
 
-  if (result[0] == '-') {
-    result[0] = 'P';
+/**
+ * @brief Applies a binary operator to the operands.
+ * @param code The operator.
+ * @param left The left operand, replaced with the result.
+ * @param right The right operand.
+ * @return False if the operands are out of the operator domain.
+ */
+bool CalculatorModel::calculate(OpCode code, long double &left,
+                                long double right) noexcept {
+  switch (code) {
+    case OpCode::ADD:
+      left += right;
+      break;
+    case OpCode::SUB:
+      left -= right;
+      break;
+    case OpCode::MUL:
+      left *= right;
+      break;
+    case OpCode::DIV:
+      if (!right) return false;
+      left /= right;
+      break;
+    case OpCode::MOD:
+      left = std::fmod(left, right);
+      if (left < 0) left += right;
+      break;
+    case OpCode::POW:
+      left = std::pow(left, right);
+      break;
+    default:
+      break;
   }
 
-  result = replaceSubstr(result, "asin(", "S(");
-  result = replaceSubstr(result, "acos(", "C(");
-  result = replaceSubstr(result, "atan(", "T(");
-  result = replaceSubstr(result, "sqrt(", "Q(");
-  result = replaceSubstr(result, "sin(", "s(");
-  result = replaceSubstr(result, "cos(", "c(");
-  result = replaceSubstr(result, "tan(", "t(");
-  result = replaceSubstr(result, "log(", "L(");
-  result = replaceSubstr(result, "ln(", "l(");
-  result = replaceSubstr(result, "mod", "m");
-  result = replaceSubstr(result, ")(", ")*(");
-  result = replaceSubstr(result, "(+", "(");
-  result = replaceSubstr(result, "(-", "((P1)*");
+  if (!(std::fabs(left) > kLdoubleMinVal)) left = 0.0L;
 
-  std::regex digit_bracket{"(\\d)\\("};
-  result = std::regex_replace(result, digit_bracket, "$1*(");
+  return true;
+}
 
-  std::regex bracket_digit{"\\)(\\d)"};
-  result = std::regex_replace(result, bracket_digit, ")*$1");
+/**
+ * @brief Applies a function to the operand.
+ * @param code The function.
+ * @param top The operand, replaced with the result.
+ * @return False if the operand is out of the function domain.
+ */
+bool CalculatorModel::calculate(OpCode code, long double &top) noexcept {
+  switch (code) {
+    case OpCode::SIN:
+      top = std::sin(top);
+      break;
+    case OpCode::COS:
+      top = std::cos(top);
+      break;
+    case OpCode::TAN:
+      top = std::tan(top);
+      break;
+    case OpCode::ASIN:
+      if (std::fabs(top) > 1.0L) return false;
+      top = std::asin(top);
+      break;
+    case OpCode::ACOS:
+      if (std::fabs(top) > 1.0L) return false;
+      top = std::acos(top);
+      break;
+    case OpCode::ATAN:
+      top = std::atan(top);
+      break;
+    case OpCode::LN:
+      if (top < 0.0L) return false;
+      top = std::log(top);
+      break;
+    case OpCode::LOG:
+      if (top < 0.0L) return false;
+      top = std::log10(top);
+      break;
+    case OpCode::SQRT:
+      if (top < 0.0L) return false;
+      top = std::sqrt(top);
+      break;
+    case OpCode::NEG:
+      top *= -1.0L;
+      break;
+    default:
+      break;
+  }
 
-  result = replaceSubstr(result, "e", "(2.7182818284590452353671352)");
-  result = replaceSubstr(result, "E", "e");
+  if (!(std::fabs(top) > kLdoubleMinVal)) top = 0.0L;
 
-  for (std::size_t i{}; i != result.size(); ++i) {
-    if (isdigit(result[i]) && isFunction(result[i + 1]) && result[i] != 'P') {
-      result.insert(++i, "*");
-    }
+  return true;
+}
+
+/**
+ * @brief Returns the domain error message of an operation.
+ * @param code The operation.
+ * @return The error message.
+ */
+const char *CalculatorModel::errorMessage(OpCode code) noexcept {
+  const char *message{"invalid expression"};
+
+  if (code == OpCode::DIV) {
+    message = "divide to zero";
+  } else if (code == OpCode::ASIN) {
+    message = "asin: wrong range";
+  } else if (code == OpCode::ACOS) {
+    message = "acos: wrong range";
+  } else if (code == OpCode::LN) {
+    message = "ln: negative number";
+  } else if (code == OpCode::LOG) {
+    message = "log: negative number";
+  } else if (code == OpCode::SQRT) {
+    message = "sqrt: negative number";
   }
 
-  return result;
+  return message;
+}
+
+/**
+ * @brief Evaluates the postfix expression and returns the result as a string.
+ * @return The result of the evaluation as a string.
+ */
+std::string CalculatorModel::evaluate_str() const {
+  std::ostringstream stream;
+  long double result{evaluate()};
+  stream << std::fixed << std::setprecision(7) << result;
+  std::string result_str{stream.str()};
+
+  while (result_str.back() == '0' || result_str.back() == '.') {
+    result_str.pop_back();
+  }
+
+  return result_str;
 }
 
 /**
- * @brief Gets the precedence of an operator.
- * @param op The operator.
- * @return The precedence of the operator.
+ * @brief Gets the precedence of an operator or a function.
+ * @param token The token.
+ * @return The precedence of the token.
  */
-int CalculatorModel::getPrecedence(char op) {
+int CalculatorModel::getPrecedence(const Token &token) noexcept {
   int priority{};
 
-  if (op == '+' || op == '-') {
+  if (token.type == TokenType::FUNCTION) {
+    priority = 4;
+  } else if (token.type != TokenType::OPERATOR) {
+    priority = 0;
+  } else if (token.code == OpCode::ADD || token.code == OpCode::SUB) {
     priority = 1;
-  } else if (op == '*' || op == '/' || op == 'm') {
-    priority = 2;
-  } else if (op == '^') {
+  } else if (token.code == OpCode::POW) {
     priority = 3;
-  } else if (op == 's' || op == 'c' || op == 't' || op == 'S' || op == 'C' ||
-             op == 'T' || op == 'l' || op == 'L' || op == 'Q' || op == 'P') {
-    priority = 4;
+  } else {
+    priority = 2;
   }
 
   return priority;
 }
 
 /**
- * @brief Checks if a character is an operator.
- * @param c The character to check.
- * @return True if the character is an operator, false otherwise.
+ * @brief Converts an operator character to the operation code.
+ * @param op The operator character.
+ * @return The operation code.
+ */
+CalculatorModel::OpCode CalculatorModel::toOpCode(char op) noexcept {
+  OpCode code{OpCode::ADD};
+
+  if (op == '-') {
+    code = OpCode::SUB;
+  } else if (op == '*') {
+    code = OpCode::MUL;
+  } else if (op == '/') {
+    code = OpCode::DIV;
+  } else if (op == '^') {
+    code = OpCode::POW;
+  }
+
+  return code;
+}
+
+/**
+ * @brief Checks if an operation takes two operands.
+ * @param code The operation code.
+ * @return True if the operation is binary, false otherwise.
  */
-bool CalculatorModel::isOperator(char c) const noexcept {
-  return c == '+' || c == '-' || c == '*' || c == '/' || c == '^' || c == 'm';
+bool CalculatorModel::isBinary(OpCode code) noexcept {
+  return code == OpCode::ADD || code == OpCode::SUB || code == OpCode::MUL ||
+         code == OpCode::DIV || code == OpCode::MOD || code == OpCode::POW;
 }
 
 /**
- * @brief Checks if a character is a function.
- * @param c The character to check.
- * @return True if the character is a function, false otherwise.
+ * @brief Checks if a token type ends an operand.
+ * @param type The token type.
+ * @return True for numbers, the variable and closing brackets.
  */
-bool CalculatorModel::isFunction(char c) const noexcept {
-  return c == 's' || c == 'c' || c == 't' || c == 'S' || c == 'C' || c == 'T' ||
-         c == 'l' || c == 'L' || c == 'Q' || c == 'P';
+bool CalculatorModel::isOperandEnd(TokenType type) noexcept {
+  return type == TokenType::NUMBER || type == TokenType::VARIABLE ||
+         type == TokenType::CLOSE_BRACKET;
 }
 
 }  // namespace s21
@@ -14,93 +14,175 @@
 namespace s21 {
 
 /// @brief Constructs a CreditModel object.
-CreditModel::CreditModel() : BaseModel{} { data_ = new Data; }
-
-/// @brief Destructs the CreditModel object.
-CreditModel::~CreditModel() { delete data_; }
+CreditModel::CreditModel() : BaseModel{} {}
 
 /**
  * @brief Adds data to the credit model.
  * @param data The data to add.
  */
 void CreditModel::addData(const Data &data) noexcept {
-  *data_ = data;
-  data_->rate /= 100.0L;
+  data_ = data;
+  data_.rate /= 100.0L;
 
-  if (data_->term_type == TermType::YEARS) {
-    data_->term *= Date::kYearMonths;
+  if (data_.term_type == TermType::YEARS) {
+    data_.term *= Date::kYearMonths;
   }
 }
 
 /// @brief Clears the table of payments.
-void CreditModel::clear() noexcept { table_.clear(); }
+void CreditModel::clear() noexcept { schedule_.clear(); }
 
 /// @brief Calculates the payments for the credit model.
-void CreditModel::calculatePayments() noexcept {
-  Date::DateSize const_day{data_->date.day()};
-  long double annuity_cycle{data_->amount};
-  month_->current = data_->date;
-  month_->payment_date = data_->date;
-  month_->balance = data_->amount;
-
-  if (data_->type == Type::FIRST) {
-    long double monthly_percent = data_->rate / Date::kYearMonths;
-    month_->summary =
-        roundVal(month_->balance * monthly_percent /
-                 (1.0L - std::pow((1.0L + monthly_percent), -data_->term)));
+void CreditModel::calculatePayments() {
+  withDayCount(data_.day_count, [this](auto convention) {
+    calculateSchedule<decltype(convention)>();
+  });
+}
+
+/**
+ * @brief Calculates the payments by the day count convention.
+ * @tparam Convention The day count policy of the interest.
+ */
+template <class Convention>
+void CreditModel::calculateSchedule() {
+  std::size_t term{
+      std::max(static_cast<std::size_t>(data_.term), std::size_t{1})};
+  std::size_t period{};
+  std::pmr::vector<Date> dates{scratch()};
+  long double annuity_cycle{data_.amount};
+  month_.current = data_.date;
+  month_.payment_date = data_.date;
+  month_.balance = data_.amount;
+  rest_ = 0.0L;
+  interest_ = 0.0L;
+
+  if (storesSchedule()) schedule_.reserve(schedule_.size() + term);
+
+  if (data_.type == Type::FIRST) {
+    long double monthly_percent = data_.rate / Date::kYearMonths;
+    month_.summary =
+        roundVal(annuity(month_.balance, monthly_percent, data_.term));
   } else {
-    month_->main = roundVal(month_->balance / data_->term);
+    month_.main = roundVal(month_.balance / data_.term);
   }
 
-  while (month_->balance) {
-    month_->payment_date.addCreditMonth(const_day);
+  while (month_.balance) {
+    if (period == dates.size()) {
+      Calendar::creditSchedule(data_.date, term, dates, data_.holidays);
+    }
+
+    month_.payment_date = dates[period];
 
-    calculatePeriod();
+    calculatePeriod<Convention>();
 
-    if ((table_.size() > 500 && month_->balance == annuity_cycle) ||
-        month_->balance < 1.0e-3) {
-      month_->balance = 0.0L;
+    if ((period > kCyclePeriods && month_.balance == annuity_cycle) ||
+        month_.balance < 1.0e-3) {
+      month_.balance = 0.0L;
     }
 
-    month_->current = month_->payment_date;
+    month_.current = month_.payment_date;
+    interest_ += month_.percent;
     monthToTable();
+    ++period;
   }
 }
 
-/// @brief Calculates the period for the credit model.
+/**
+ * @brief Calculates the period for the credit model.
+ * @tparam Convention The day count policy of the interest.
+ */
+template <class Convention>
 void CreditModel::calculatePeriod() noexcept {
-  month_->percent = roundVal(formula(month_->current, month_->payment_date));
-
-  if (data_->type == Type::FIRST) {
-    static long double rest{};
+  month_.percent =
+      roundVal(formula<Convention>(month_.current, month_.payment_date));
 
-    if (rest) {
-      month_->percent += rest;
-      rest = 0.0L;
+  if (data_.type == Type::FIRST) {
+    if (rest_) {
+      month_.percent += rest_;
+      rest_ = 0.0L;
     }
 
-    if (month_->percent > month_->summary) {
-      rest = month_->percent - month_->summary;
-      month_->percent = month_->summary;
-      month_->main = 0.0L;
+    if (month_.percent > month_.summary) {
+      rest_ = month_.percent - month_.summary;
+      month_.percent = month_.summary;
+      month_.main = 0.0L;
     } else {
-      if (month_->balance > month_->summary ||
-          month_->balance + month_->percent > month_->summary) {
-        month_->main = month_->summary - month_->percent;
+      if (month_.balance > month_.summary ||
+          month_.balance + month_.percent > month_.summary) {
+        month_.main = month_.summary - month_.percent;
       } else {
-        month_->main = month_->balance;
-        month_->summary = month_->main + month_->percent;
+        month_.main = month_.balance;
+        month_.summary = month_.main + month_.percent;
       }
     }
   } else {
-    if (month_->balance < month_->main) {
-      month_->main = month_->balance;
+    if (month_.balance < month_.main) {
+      month_.main = month_.balance;
     }
 
-    month_->summary = month_->main + month_->percent;
+    month_.summary = month_.main + month_.percent;
   }
 
-  month_->balance -= month_->main;
+  month_.balance -= month_.main;
+}
+
+/**
+ * @brief Returns the monthly annuity payment.
+ * @param amount The amount of the credit.
+ * @param monthly_percent The interest rate of a month.
+ * @param term The number of months.
+ * @return The payment, not rounded.
+ */
+long double CreditModel::annuity(long double amount,
+                                 long double monthly_percent,
+                                 long double term) noexcept {
+  if (!monthly_percent) return amount / term;
+
+  return amount * monthly_percent /
+         (1.0L - std::pow((1.0L + monthly_percent), -term));
+}
+
+/**
+ * @brief Calculates the totals of the credit in closed form.
+ *
+ * Every month accrues one twelfth of the annual rate, as under the monthly
+ * 30/360 convention, and the payments are not rounded. The calendar, the
+ * holidays and the day count convention of the data are ignored, so the
+ * result may differ from calculateTotals by a few cents.
+ * @return The interest, debt and total paid.
+ */
+BaseModel::Totals CreditModel::quote() const noexcept {
+  long double term{std::max(data_.term, 1.0L)};
+  long double monthly_percent{data_.rate / Date::kYearMonths};
+  long double interest{};
+  Totals totals;
+
+  if (data_.type == Type::FIRST) {
+    interest = annuity(data_.amount, monthly_percent, term) * term -
+               data_.amount;
+  } else {
+    interest = data_.amount * monthly_percent * (term + 1.0L) / 2.0L;
+  }
+
+  totals.interest = roundVal(interest);
+  totals.debt = data_.amount;
+  totals.total = data_.amount + totals.interest;
+
+  return totals;
+}
+
+/**
+ * @brief Returns the totals of the calculated payments.
+ * @return The interest, debt and total paid.
+ */
+BaseModel::Totals CreditModel::totals() const noexcept {
+  Totals totals;
+
+  totals.interest = interest_;
+  totals.debt = data_.amount;
+  totals.total = data_.amount + interest_;
+
+  return totals;
 }
 
 /**
@@ -109,13 +191,11 @@ void CreditModel::calculatePeriod() noexcept {
  */
 std::vector<std::string> CreditModel::totalTable() const noexcept {
   std::vector<std::string> total;
-  long double percent{};
-
-  for (auto i : table_) percent += std::stold(i[1]);
+  Totals sum{totals()};
 
-  auto profit{toStr(percent)};
-  auto debt{toStr(data_->amount)};
-  auto ttotal{toStr(data_->amount + percent)};
+  auto profit{toStr(sum.interest)};
+  auto debt{toStr(sum.debt)};
+  auto ttotal{toStr(sum.total)};
 
   total.emplace_back(std::string("Interest paid\n") + profit);
   total.emplace_back(std::string("Debt paid\n") + debt);
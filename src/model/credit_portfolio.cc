@@ -0,0 +1,144 @@
+/**
+ * @file credit_portfolio.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the CreditPortfolio class.
+ * @version 1.0
+ * @date 2024-10-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/model/credit_portfolio.h"
+
+namespace s21 {
+
+/**
+ * @brief Returns the number of credits.
+ * @return The number of credits.
+ */
+std::size_t CreditPortfolio::Loans::size() const noexcept {
+  return amount.size();
+}
+
+/**
+ * @brief Reserves memory for the credits.
+ * @param loans The expected number of credits.
+ */
+void CreditPortfolio::Loans::reserve(std::size_t loans) {
+  amount.reserve(loans);
+  term.reserve(loans);
+  rate.reserve(loans);
+  type.reserve(loans);
+  date.reserve(loans);
+}
+
+/**
+ * @brief Appends a credit.
+ * @param amount_ The amount of the credit.
+ * @param term_ The term of the credit in months.
+ * @param rate_ The interest rate.
+ * @param type_ The type of the credit.
+ * @param date_ The start date of the credit.
+ */
+void CreditPortfolio::Loans::add(long double amount_, std::size_t term_,
+                                 long double rate_, Type type_,
+                                 const Date &date_) {
+  amount.push_back(amount_);
+  term.push_back(term_);
+  rate.push_back(rate_);
+  type.push_back(type_);
+  date.push_back(date_);
+}
+
+/**
+ * @brief Collects the parameters of a credit.
+ * @param index The index of the credit.
+ * @return The data of the credit model.
+ */
+CreditModel::Data CreditPortfolio::Loans::data(
+    std::size_t index) const noexcept {
+  CreditModel::Data data{amount[index],
+                         static_cast<long double>(term[index]),
+                         CreditModel::TermType::MONTHS,
+                         rate[index],
+                         type[index],
+                         date[index]};
+  data.holidays = holidays;
+  data.day_count = day_count;
+
+  return data;
+}
+
+/**
+ * @brief Constructs a CreditPortfolio object.
+ * @param threads The number of worker threads, zero for the hardware ones.
+ */
+CreditPortfolio::CreditPortfolio(std::size_t threads) : pool_{threads} {}
+
+/**
+ * @brief Calculates the interest and the total payment of every credit.
+ * @param loans The credits.
+ * @return The totals in the order of the credits.
+ */
+CreditPortfolio::Totals CreditPortfolio::totals(const Loans &loans) {
+  Totals totals;
+
+  totals.interest.resize(loans.size());
+  totals.total.resize(loans.size());
+
+  calculate(loans, [&totals](CreditModel &model, std::size_t index) {
+    CreditModel::Totals credit{model.calculateTotals()};
+
+    totals.interest[index] = credit.interest;
+    totals.total[index] = credit.total;
+  });
+
+  return totals;
+}
+
+/**
+ * @brief Calculates the payment schedule of every credit.
+ * @param loans The credits.
+ * @return The schedules in the order of the credits.
+ */
+std::vector<CreditPortfolio::Schedule> CreditPortfolio::schedules(
+    const Loans &loans) {
+  std::vector<Schedule> schedules(loans.size());
+
+  calculate(loans, [&schedules](CreditModel &model, std::size_t index) {
+    model.calculatePayments();
+    schedules[index] = model.schedule();
+  });
+
+  return schedules;
+}
+
+/**
+ * @brief Calculates the credits on the thread pool.
+ *
+ * The credits are split into contiguous chunks, and every chunk reuses one
+ * model for all of its credits.
+ * @param loans The credits.
+ * @param visitor The function calculating the model loaded with a credit.
+ */
+void CreditPortfolio::calculate(const Loans &loans, const Visitor &visitor) {
+  std::size_t count{loans.size()};
+  std::size_t chunks{std::min(count, pool_.size() * kChunksPerThread)};
+
+  if (!chunks) return;
+
+  pool_.parallelFor(chunks, [&loans, &visitor, count,
+                             chunks](std::size_t chunk) {
+    CreditModel model;
+    std::size_t last{count * (chunk + 1) / chunks};
+
+    for (std::size_t i{count * chunk / chunks}; i < last; ++i) {
+      model.clear();
+      model.addData(loans.data(i));
+      visitor(model, i);
+    }
+  });
+}
+
+}  // namespace s21
@@ -14,14 +14,7 @@
 namespace s21 {
 
 /// @brief Constructs a DepositModel object.
-DepositModel::DepositModel() : BaseModel{}, data_{new Data}, tax_{new Tax} {}
-
-/// @brief Destructs the DepositModel object.
-DepositModel::~DepositModel() {
-  delete data_->base;
-  delete data_;
-  delete tax_;
-}
+DepositModel::DepositModel() : BaseModel{} {}
 
 /**
  * @brief Constructs an Operation object with the given parameters.
@@ -49,8 +42,7 @@ DepositModel::Data::Data(long double amount_, long double term_,
                          TermType term_type_, long double rate_,
                          long double tax_rate_, Type type_, Frequency freq_,
                          const Date &date_, std::vector<Operation> *ops_)
-    : base{new BaseModel::Data{amount_, term_, term_type_, rate_, type_,
-                               date_}},
+    : base{amount_, term_, term_type_, rate_, type_, date_},
       freq{freq_},
       tax_rate{tax_rate_} {
   if (ops_) {
@@ -63,14 +55,11 @@ DepositModel::Data::Data(long double amount_, long double term_,
  * @param data The data to add.
  */
 void DepositModel::addData(const Data &data) noexcept {
-  *tax_ = Tax{};
-  data_->base = data.base;
-  data_->freq = data.freq;
-  data_->tax_rate = data.tax_rate;
-  data_->ops = data.ops;
-  tax_->nontaxable *= data_->tax_rate;
-  BaseModel::data_ = data_->base;
-  BaseModel::data_->rate /= 100.0L;
+  tax_ = Tax{};
+  data_ = data;
+  tax_.nontaxable *= data_.tax_rate;
+  BaseModel::data_ = data_.base;
+  BaseModel::data_.rate /= 100.0L;
 }
 
 /**
@@ -78,34 +67,66 @@ void DepositModel::addData(const Data &data) noexcept {
  * @param op The operation to add.
  */
 void DepositModel::addOperation(const Operation &op) noexcept {
-  data_->ops.push_back(op);
+  data_.ops.push_back(op);
 }
 
 /// @brief Clears the table of payments and operations.
 void DepositModel::clear() noexcept {
-  table_.clear();
+  schedule_.clear();
   tax_table_.clear();
-  data_->ops.clear();
+  data_.ops.clear();
+}
+
+/**
+ * @brief Calculates the payments for the deposit model.
+ *
+ * Every run starts from the added data, so the model can be calculated
+ * again in any mode with the same result.
+ */
+void DepositModel::calculatePayments() {
+  withDayCount(BaseModel::data_.day_count, [this](auto convention) {
+    calculateSchedule<decltype(convention)>();
+  });
 }
 
-/// @brief Calculates the payments for the deposit model.
-void DepositModel::calculatePayments() noexcept {
-  month_->current = BaseModel::data_->date;
-  month_->payment_date = BaseModel::data_->date;
-  month_->balance = BaseModel::data_->amount;
+/**
+ * @brief Calculates the payments by the day count convention.
+ * @tparam Convention The day count policy of the interest.
+ */
+template <class Convention>
+void DepositModel::calculateSchedule() {
+  long double nontaxable{tax_.nontaxable};
+  tax_ = Tax{};
+  tax_.nontaxable = nontaxable;
+
+  if (!summary_) tax_table_.clear();
+
+  month_.current = BaseModel::data_.date;
+  month_.payment_date = BaseModel::data_.date;
+  month_.balance = BaseModel::data_.amount;
   Date last_day{lastDepositDay()};
   sortOperations();
 
-  while (month_->current != last_day) {
-    addPeriod(last_day);
+  std::pmr::vector<Date> dates{paymentDates(last_day)};
+
+  if (!dates.empty()) {
+    last_day = dates.back();
+  }
+
+  if (storesSchedule()) {
+    schedule_.reserve(schedule_.size() + dates.size());
+  }
 
-    calculateOperations();
+  for (const Date &payment_date : dates) {
+    month_.payment_date = payment_date;
 
-    calculatePeriod();
+    calculateOperations<Convention>();
+
+    calculatePeriod<Convention>();
 
     calculateTaxes(last_day);
 
-    month_->current = month_->payment_date;
+    month_.current = month_.payment_date;
     monthToTable();
   }
 }
@@ -115,60 +136,63 @@ void DepositModel::calculatePayments() noexcept {
  * @return The last day of the deposit.
  */
 Date DepositModel::lastDepositDay() const noexcept {
-  Date last_day{month_->current};
-  Date::DateSize init_day{month_->current.day()};
+  Date last_day{month_.current};
+  Date::DateSize init_day{month_.current.day()};
 
-  if (BaseModel::data_->term_type == TermType::DAYS) {
-    last_day.addDays(BaseModel::data_->term);
+  if (BaseModel::data_.term_type == TermType::DAYS) {
+    last_day.addDays(BaseModel::data_.term);
   } else {
-    std::size_t term = BaseModel::data_->term;
+    std::size_t term = BaseModel::data_.term;
 
-    if (BaseModel::data_->term_type == TermType::YEARS) {
+    if (BaseModel::data_.term_type == TermType::YEARS) {
       term *= Date::kYearMonths;
     }
 
-    for (std::size_t i{}; i < term; ++i) {
-      last_day.addCreditMonth(init_day);
-    }
+    last_day = Calendar::addMonths(last_day, term, init_day);
   }
 
   return last_day;
 }
 
 /**
- * @brief Adds a period to the deposit model.
+ * @brief Generates the payment dates of the deposit.
  * @param last_day The last day of the deposit.
+ * @return The payment dates in the calculation arena.
  */
-void DepositModel::addPeriod(const Date &last_day) noexcept {
-  std::size_t period{static_cast<std::size_t>(data_->freq)};
-
-  if (data_->freq == Frequency::ENDTERM) {
-    month_->payment_date = last_day;
-  } else if (data_->freq == Frequency::DAY) {
-    month_->payment_date.addDays(1);
-  } else if (data_->freq == Frequency::WEEK) {
-    month_->payment_date.addDays(7);
-  } else {
-    month_->payment_date.addDepositMonth(period);
+std::pmr::vector<Date> DepositModel::paymentDates(const Date &last_day) {
+  std::size_t days{};
+  std::size_t months{};
+
+  if (data_.freq == Frequency::DAY) {
+    days = 1;
+  } else if (data_.freq == Frequency::WEEK) {
+    days = 7;
+  } else if (data_.freq != Frequency::ENDTERM) {
+    months = static_cast<std::size_t>(data_.freq);
   }
 
-  if (month_->payment_date > last_day) {
-    month_->payment_date = last_day;
-  }
+  return Calendar::depositSchedule(BaseModel::data_.date, last_day, days,
+                                   months, BaseModel::data_.holidays,
+                                   scratch());
 }
 
-/// @brief Calculates the period for the deposit model.
+/**
+ * @brief Calculates the period for the deposit model.
+ * @tparam Convention The day count policy of the interest.
+ */
+template <class Convention>
 void DepositModel::calculatePeriod() noexcept {
-  month_->percent = roundVal(formula(month_->current, month_->payment_date) +
-                             data_->ops_percent);
+  month_.percent =
+      roundVal(formula<Convention>(month_.current, month_.payment_date) +
+               data_.ops_percent);
 
-  if (BaseModel::data_->type == Type::FIRST) {
-    month_->summary = 0.0L;
-    month_->main = month_->percent;
+  if (BaseModel::data_.type == Type::FIRST) {
+    month_.summary = 0.0L;
+    month_.main = month_.percent;
   } else {
-    month_->summary = month_->percent;
-    month_->main = 0.0L;
-    month_->balance += roundVal(month_->percent);
+    month_.summary = month_.percent;
+    month_.main = 0.0L;
+    month_.balance += roundVal(month_.percent);
   }
 }
 
@@ -177,75 +201,67 @@ void DepositModel::calculatePeriod() noexcept {
  * @param last_day The last day of the deposit.
  */
 void DepositModel::calculateTaxes(const Date &last_day) {
-  tax_->total_profit_ += month_->percent;
+  tax_.total_profit_ += month_.percent;
 
-  if (month_->current.year() != month_->payment_date.year() ||
-      month_->payment_date == last_day) {
-    if (month_->payment_date == last_day) {
-      tax_->income += month_->percent;
-      tax_->year = last_day.year();
+  if (month_.current.year() != month_.payment_date.year() ||
+      month_.payment_date == last_day) {
+    if (month_.payment_date == last_day) {
+      tax_.income += month_.percent;
+      tax_.year = last_day.year();
     } else {
-      tax_->year = month_->current.year();
+      tax_.year = month_.current.year();
     }
 
-    if (tax_->income > tax_->nontaxable) {
-      tax_->income_deduction = tax_->income - tax_->nontaxable;
-      tax_->tax_amount = roundVal(tax_->income_deduction * kNDFLRate);
-      tax_->total_tax_ += tax_->tax_amount;
+    if (tax_.income > tax_.nontaxable) {
+      tax_.income_deduction = tax_.income - tax_.nontaxable;
+      tax_.tax_amount = roundVal(tax_.income_deduction * kNDFLRate);
+      tax_.total_tax_ += tax_.tax_amount;
     }
 
-    taxToTable();
+    if (!summary_) taxToTable();
 
-    tax_->income = 0.0L;
-    tax_->income_deduction = 0.0L;
+    tax_.income = 0.0L;
+    tax_.income_deduction = 0.0L;
   }
 
-  if (month_->payment_date != last_day) {
-    tax_->income += month_->percent;
+  if (month_.payment_date != last_day) {
+    tax_.income += month_.percent;
   } else {
-    tax_->income -= month_->percent;
+    tax_.income -= month_.percent;
   }
 }
 
-/// @brief Calculates the operations for the deposit model.
+/**
+ * @brief Calculates the operations for the deposit model.
+ * @tparam Convention The day count policy of the interest.
+ */
+template <class Convention>
 void DepositModel::calculateOperations() {
-  data_->ops_percent = 0.0L;
+  data_.ops_percent = 0.0L;
 
-  if (!data_->ops.size()) {
-    return;
-  }
+  for (; next_op_ < data_.ops.size(); ++next_op_) {
+    const Operation &op{data_.ops[next_op_]};
 
-  auto op = data_->ops.begin();
-  Date payment_date{month_->payment_date};
+    if (op.date < month_.current || op.date >= month_.payment_date) break;
 
-  while (data_->ops.size() && op->date >= month_->current &&
-         op->date < month_->payment_date) {
-    if (op->type == OperationType::WITHDRAWAL &&
-        (month_->balance < op->sum || month_->balance - op->sum < 0)) {
-      data_->ops.erase(data_->ops.begin());
+    if (op.type == OperationType::WITHDRAWAL &&
+        (month_.balance < op.sum || month_.balance - op.sum < 0)) {
       continue;
     } else {
-      if (op->type == OperationType::REFILL) {
-        month_->summary = op->sum;
+      if (op.type == OperationType::REFILL) {
+        month_.summary = op.sum;
       } else {
-        month_->summary = -op->sum;
+        month_.summary = -op.sum;
       }
     }
 
-    data_->ops_percent += formula(month_->current, op->date);
+    data_.ops_percent += formula<Convention>(month_.current, op.date);
 
-    month_->current = op->date;
-    month_->balance += month_->summary;
-    month_->main = 0.0L;
-    month_->percent = 0.0L;
+    month_.current = op.date;
+    month_.balance += month_.summary;
+    month_.main = 0.0L;
+    month_.percent = 0.0L;
     monthToTable();
-
-    data_->ops.erase(data_->ops.begin());
-    if (data_->ops.size()) {
-      op = data_->ops.begin();
-    } else {
-      break;
-    }
   }
 }
 
@@ -253,32 +269,54 @@ void DepositModel::calculateOperations() {
 void DepositModel::taxToTable() noexcept {
   std::vector<std::string> str_year;
 
-  str_year.emplace_back(std::to_string(tax_->year));
-  str_year.emplace_back(toStr(tax_->income));
-  str_year.emplace_back(toStr(tax_->nontaxable));
-  str_year.emplace_back(toStr(tax_->income_deduction));
-  str_year.emplace_back(toStr(tax_->tax_amount));
-  str_year.emplace_back("Pay by 01.12." + std::to_string(tax_->year + 1));
+  str_year.emplace_back(std::to_string(tax_.year));
+  str_year.emplace_back(toStr(tax_.income));
+  str_year.emplace_back(toStr(tax_.nontaxable));
+  str_year.emplace_back(toStr(tax_.income_deduction));
+  str_year.emplace_back(toStr(tax_.tax_amount));
+  str_year.emplace_back("Pay by 01.12." + std::to_string(tax_.year + 1));
 
   tax_table_.emplace_back(str_year);
 }
 
-/// @brief Sorts the operations by date.
+/**
+ * @brief Sorts the operations by date keeping the order of the same day.
+ *
+ * The operations before the start of the deposit are skipped.
+ */
 void DepositModel::sortOperations() {
-  Operation temp;
-  for (std::size_t i{}; i < data_->ops.size(); ++i) {
-    for (std::size_t j{}; j < data_->ops.size() - i - 1; ++j) {
-      if (data_->ops[j + 1].date < data_->ops[j].date) {
-        temp = data_->ops[j];
-        data_->ops[j] = data_->ops[j + 1];
-        data_->ops[j + 1] = temp;
-      }
-    }
-  }
+  std::stable_sort(data_.ops.begin(), data_.ops.end(),
+                   [](const Operation &first, const Operation &second) {
+                     return first.date < second.date;
+                   });
+
+  next_op_ = static_cast<std::size_t>(
+      std::lower_bound(data_.ops.begin(), data_.ops.end(),
+                       BaseModel::data_.date,
+                       [](const Operation &op, const Date &date) {
+                         return op.date < date;
+                       }) -
+      data_.ops.begin());
+}
 
-  while (data_->ops.size() && data_->ops[0].date < BaseModel::data_->date) {
-    data_->ops.erase(data_->ops.begin());
-  }
+/**
+ * @brief Returns the totals of the calculated payments.
+ * @return The profit, tax, effective rate, total balance and balance.
+ */
+BaseModel::Totals DepositModel::totals() const noexcept {
+  Totals totals;
+
+  totals.interest = tax_.total_profit_;
+  totals.tax = tax_.total_tax_;
+  totals.effective_rate =
+      tax_.total_profit_ / BaseModel::data_.amount * Date::kYearDays /
+      (month_.payment_date - BaseModel::data_.date) * 100.0L;
+  totals.total = (BaseModel::data_.type == Type::SECOND)
+                     ? month_.balance
+                     : BaseModel::data_.amount + tax_.total_profit_;
+  totals.balance = month_.balance;
+
+  return totals;
 }
 
 /**
@@ -287,16 +325,13 @@ void DepositModel::sortOperations() {
  */
 std::vector<std::string> DepositModel::totalTable() const noexcept {
   std::vector<std::string> total_str;
-  auto eff_rate{
-      toStr(tax_->total_profit_ / BaseModel::data_->amount * Date::kYearDays /
-            (month_->payment_date - BaseModel::data_->date) * 100.0L)};
-  auto tbalance{toStr((BaseModel::data_->type == Type::SECOND)
-                          ? month_->balance
-                          : BaseModel::data_->amount + tax_->total_profit_)};
-  auto tax_prof{toStr(tax_->total_profit_ - tax_->total_tax_)};
-  auto tprofit{toStr(tax_->total_profit_)};
-  auto ttax{toStr(tax_->total_tax_)};
-  auto balance{toStr(month_->balance)};
+  Totals sum{totals()};
+  auto eff_rate{toStr(sum.effective_rate)};
+  auto tbalance{toStr(sum.total)};
+  auto tax_prof{toStr(sum.interest - sum.tax)};
+  auto tprofit{toStr(sum.interest)};
+  auto ttax{toStr(sum.tax)};
+  auto balance{toStr(sum.balance)};
 
   total_str.emplace_back(std::string("Profit\n") + tprofit);
   total_str.emplace_back(std::string("Total tax\n") + ttax);
@@ -0,0 +1,114 @@
+/**
+ * @file expression_cache.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Implementation of the ExpressionCache class.
+ * @version 1.0
+ * @date 2024-10-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "include/model/expression_cache.h"
+
+namespace s21 {
+
+/**
+ * @brief Constructs an ExpressionCache object.
+ * @param capacity The maximum number of cached expressions.
+ */
+ExpressionCache::ExpressionCache(std::size_t capacity)
+    : capacity_{capacity ? capacity : 1} {}
+
+/**
+ * @brief Normalizes an infix expression to a cache key.
+ * @param infix The infix expression.
+ * @return The expression without spaces.
+ */
+std::string ExpressionCache::normalize(const std::string &infix) {
+  std::string key;
+  key.reserve(infix.size());
+
+  for (auto i : infix) {
+    if (i != ' ') key += i;
+  }
+
+  return key;
+}
+
+/**
+ * @brief Looks up a compiled expression and marks it as recently used.
+ * @param key The normalized infix expression.
+ * @return A pointer to the entry, or nullptr if it is not cached.
+ */
+const ExpressionCache::Entry *ExpressionCache::find(
+    const std::string &key) noexcept {
+  auto it{index_.find(key)};
+
+  if (it == index_.end()) {
+    ++misses_;
+    return nullptr;
+  }
+
+  ++hits_;
+  items_.splice(items_.begin(), items_, it->second);
+
+  return &it->second->second;
+}
+
+/**
+ * @brief Adds a compiled expression, evicting the least recently used one.
+ * @param key The normalized infix expression.
+ * @param entry The compiled expression.
+ */
+void ExpressionCache::insert(const std::string &key, const Entry &entry) {
+  auto it{index_.find(key)};
+
+  if (it != index_.end()) {
+    it->second->second = entry;
+    items_.splice(items_.begin(), items_, it->second);
+    return;
+  }
+
+  if (items_.size() >= capacity_) {
+    index_.erase(items_.back().first);
+    items_.pop_back();
+  }
+
+  items_.emplace_front(key, entry);
+  index_.emplace(key, items_.begin());
+}
+
+/// @brief Removes all entries and resets the counters.
+void ExpressionCache::clear() noexcept {
+  items_.clear();
+  index_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+/**
+ * @brief Returns the number of cached expressions.
+ * @return The number of cached expressions.
+ */
+std::size_t ExpressionCache::size() const noexcept { return items_.size(); }
+
+/**
+ * @brief Returns the maximum number of cached expressions.
+ * @return The capacity of the cache.
+ */
+std::size_t ExpressionCache::capacity() const noexcept { return capacity_; }
+
+/**
+ * @brief Returns the number of successful lookups.
+ * @return The number of cache hits.
+ */
+std::size_t ExpressionCache::hits() const noexcept { return hits_; }
+
+/**
+ * @brief Returns the number of failed lookups.
+ * @return The number of cache misses.
+ */
+std::size_t ExpressionCache::misses() const noexcept { return misses_; }
+
+}  // namespace s21
@@ -12,10 +12,22 @@
 #ifndef SRC_TESTS_MAIN_TEST_H_
 #define SRC_TESTS_MAIN_TEST_H_
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
+#include "include/additional/calendar.h"
+#include "include/additional/date.h"
+#include "include/additional/date_range.h"
+#include "include/additional/day_count.h"
+#include "include/additional/holiday_calendar.h"
+#include "include/additional/sampler.h"
+#include "include/additional/segment_cache.h"
+#include "include/additional/thread_pool.h"
 #include "include/model/calculator_model.h"
 #include "include/model/credit_model.h"
+#include "include/model/credit_portfolio.h"
 #include "include/model/deposit_model.h"
+#include "include/model/expression_cache.h"
 
 #endif  // SRC_TESTS_MAIN_TEST_H_
@@ -740,3 +740,389 @@ TEST(smartcalc, combinated_40) {
 
   testCalculating(infix, -2340.12058496L);
 }
+
+TEST(smartcalc, compiled_1) {
+  s21::CalculatorModel model;
+
+  model.add_expression("2.5e-3*x^2 + sin(x)", 0.0L);
+  model.to_postfix();
+
+  for (long double x = -5.0L; x <= 5.0L; x += 0.25L) {
+    model.set_variable(x);
+    EXPECT_NEAR(model.evaluate(), 2.5e-3L * x * x + std::sin(x), 1.0e-7L);
+  }
+}
+
+TEST(smartcalc, compiled_2) {
+  s21::CalculatorModel model;
+
+  model.add_expression("5+", 0.0L);
+  model.to_postfix();
+
+  EXPECT_FALSE(model.program().valid);
+  EXPECT_THROW(model.evaluate(), std::invalid_argument);
+}
+
+TEST(smartcalc, compiled_3) {
+  s21::CalculatorModel model;
+
+  model.add_expression("1/(x-2)", 2.0L);
+  model.to_postfix();
+
+  EXPECT_THROW(model.evaluate(), std::invalid_argument);
+  model.set_variable(3.0L);
+  EXPECT_NEAR(model.evaluate(), 1.0L, 1.0e-7L);
+}
+
+TEST(smartcalc, batch_1) {
+  s21::CalculatorModel model;
+  std::vector<double> xs, out(1000);
+
+  for (int i{}; i < 1000; ++i) xs.push_back(-10.0 + i * 0.02);
+
+  model.add_expression("ln(x)*sqrt(x+5)/(x-1) + x mod 3 - 2^x", 0.0L);
+  model.to_postfix();
+  model.evaluate_batch(xs.data(), out.data(), xs.size());
+
+  for (std::size_t i{}; i < xs.size(); ++i) {
+    model.set_variable(xs[i]);
+
+    try {
+      EXPECT_DOUBLE_EQ(out[i], static_cast<double>(model.evaluate()));
+    } catch (const std::invalid_argument &) {
+      EXPECT_TRUE(std::isnan(out[i])) << "x = " << xs[i];
+    }
+  }
+}
+
+TEST(smartcalc, batch_2) {
+  s21::CalculatorModel model;
+  double x{1.0}, out{};
+
+  model.add_expression("(", 0.0L);
+  model.to_postfix();
+
+  EXPECT_THROW(model.evaluate_batch(&x, &out, 1), std::invalid_argument);
+}
+
+void testValidation(const std::string& infix, bool expected) {
+  s21::CalculatorModel model;
+
+  model.add_expression(infix, 0.0L);
+
+  EXPECT_EQ(model.validate(), expected) << "Expression: " << infix;
+}
+
+TEST(smartcalc, validation_1) {
+  for (const char* infix :
+       {"2+2", "-x", "sinx", "2sin(x)cos(x)", "(-2)^x", "3.5e+2x", "π2", "e",
+        "x mod 2", "1.5E-3", "sqrt(x)x", "(+1)", "--2", "-+x", "(+-+x)"}) {
+    testValidation(infix, true);
+  }
+}
+
+TEST(smartcalc, validation_2) {
+  for (const char* infix :
+       {"", "2+", "*2", "2**3", "()", "(2", "2)", "1.2.3", "sin", "sin2",
+        "abc", "(2+)", "2*-x", "2--x", "2 mod", "."}) {
+    testValidation(infix, false);
+  }
+}
+
+TEST(smartcalc, unary_1) {
+  testCalculating("--x", 3.0L, 1.0e-7L, 3.0L);
+  testCalculating("-+x", -3.0L, 1.0e-7L, 3.0L);
+  testCalculating("---x", -3.0L, 1.0e-7L, 3.0L);
+  testCalculating("2*(-+-x)", 6.0L, 1.0e-7L, 3.0L);
+  testCalculating("(+-2)-(--1)", -3.0L);
+}
+
+TEST(smartcalc, implicit_1) {
+  testCalculating("2x(x+1)", 24.0L, 1.0e-7L, 3.0L);
+  testCalculating("sinx^2+cosx^2", 1.0L, 1.0e-7L, 0.7L);
+  testCalculating("x2P", 4.0L * 3.14159265358979323846L, 1.0e-7L, 2.0L);
+  testCalculating("-sin(x)", -std::sin(1.0L), 1.0e-7L, 1.0L);
+  testCalculating("1e5-3", 99997.0L);
+}
+
+TEST(smartcalc, nesting_1) {
+  const std::size_t levels{200000};
+  std::string brackets(levels, '(');
+  std::string sum{"x"};
+
+  brackets += "x+1" + std::string(levels, ')');
+
+  for (std::size_t i{}; i < levels; ++i) sum += "+x";
+
+  testCalculating(brackets, 3.0L, 1.0e-7L, 2.0L);
+  testCalculating(sum, 2.0L * (levels + 1), 1.0e-7L, 2.0L);
+}
+
+TEST(smartcalc, folding_1) {
+  s21::CalculatorModel model;
+
+  model.add_expression("sin(2)*5 + P/2 - x", 1.0L);
+  model.to_postfix();
+
+  EXPECT_EQ(model.program().code.size(), 3U);
+  EXPECT_NEAR(model.evaluate(), std::sin(2.0L) * 5.0L + 1.57079632679L - 1.0L,
+              1.0e-7L);
+}
+
+TEST(smartcalc, folding_2) {
+  s21::CalculatorModel model;
+
+  model.add_expression("(sqrt(x)+0)*1/1", 4.0L);
+  model.to_postfix();
+
+  EXPECT_EQ(model.program().code.size(), 2U);
+  EXPECT_NEAR(model.evaluate(), 2.0L, 1.0e-7L);
+}
+
+TEST(smartcalc, folding_3) {
+  s21::CalculatorModel model;
+
+  model.add_expression("x + 1/0", 4.0L);
+  model.to_postfix();
+
+  EXPECT_EQ(model.program().code.size(), 5U);
+  EXPECT_THROW(model.evaluate(), std::invalid_argument);
+}
+
+TEST(smartcalc, cache_1) {
+  s21::ExpressionCache cache{2};
+  s21::ExpressionCache::Entry entry{true, nullptr};
+
+  EXPECT_EQ(s21::ExpressionCache::normalize(" 2 + x "), "2+x");
+  EXPECT_EQ(cache.find("a"), nullptr);
+  cache.insert("a", entry);
+  cache.insert("b", entry);
+  EXPECT_NE(cache.find("a"), nullptr);
+  cache.insert("c", entry);
+
+  EXPECT_EQ(cache.find("b"), nullptr);
+  EXPECT_NE(cache.find("a"), nullptr);
+  EXPECT_NE(cache.find("c"), nullptr);
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.hits(), 3U);
+  EXPECT_EQ(cache.misses(), 2U);
+}
+
+TEST(smartcalc, cache_2) {
+  s21::CalculatorModel model;
+  s21::ExpressionCache cache;
+
+  model.add_expression("x^2", 3.0L);
+  model.to_postfix();
+  cache.insert("x^2", {model.validate(), model.compiled()});
+
+  model.add_expression("x+1", 3.0L);
+  model.to_postfix();
+  EXPECT_NEAR(model.evaluate(), 4.0L, 1.0e-7L);
+
+  model.set_program(cache.find("x^2")->program, 5.0L);
+  EXPECT_NEAR(model.evaluate(), 25.0L, 1.0e-7L);
+}
+
+TEST(smartcalc, concurrent_1) {
+  s21::CalculatorModel model;
+
+  model.add_expression("sqrt(x)*ln(x+1)", 0.0L);
+  model.to_postfix();
+
+  auto program{model.compiled()};
+  std::vector<long double> results(4);
+  std::vector<std::thread> threads;
+
+  for (std::size_t t{}; t < results.size(); ++t) {
+    threads.emplace_back([&program, &results, t] {
+      for (int i{}; i < 10000; ++i) results[t] += program->evaluate(i);
+    });
+  }
+
+  for (auto &thread : threads) thread.join();
+
+  for (auto result : results) EXPECT_EQ(result, results[0]);
+}
+
+TEST(smartcalc, sweep_1) {
+  s21::CalculatorModel model;
+  s21::ThreadPool pool{4};
+  std::vector<double> xs, serial(100000), parallel(100000);
+  const std::size_t chunk{1000};
+
+  for (std::size_t i{}; i < serial.size(); ++i) xs.push_back(i * 0.001 - 50);
+
+  model.add_expression("tan(x)/ln(x)", 0.0L);
+  model.to_postfix();
+  model.evaluate_batch(xs.data(), serial.data(), xs.size());
+
+  auto program{model.compiled()};
+  pool.parallelFor(xs.size() / chunk, [&](std::size_t i) {
+    program->evaluate_batch(xs.data() + i * chunk, parallel.data() + i * chunk,
+                            chunk);
+  });
+
+  for (std::size_t i{}; i < xs.size(); ++i) {
+    if (std::isnan(serial[i])) {
+      EXPECT_TRUE(std::isnan(parallel[i]));
+    } else {
+      EXPECT_EQ(serial[i], parallel[i]);
+    }
+  }
+}
+
+TEST(smartcalc, sweep_2) {
+  s21::ThreadPool pool{3};
+  std::vector<int> counts(1000);
+
+  for (int run{}; run < 20; ++run) {
+    pool.parallelFor(counts.size(), [&counts](std::size_t i) { ++counts[i]; });
+  }
+
+  for (auto count : counts) EXPECT_EQ(count, 20);
+  EXPECT_THROW(pool.parallelFor(
+                   10, [](std::size_t) { throw std::invalid_argument("x"); }),
+               std::invalid_argument);
+}
+
+s21::Sampler testSampler(const std::string &infix, s21::Sampler::Range range) {
+  s21::CalculatorModel model;
+  model.add_expression(infix, 0.0L);
+  model.to_postfix();
+
+  auto program{model.compiled()};
+  s21::Sampler sampler{range};
+
+  while (sampler.refine([&program](const double *xs, double *out,
+                                   std::size_t n) {
+    program->evaluate_batch(xs, out, n);
+  })) {
+  }
+
+  return sampler;
+}
+
+TEST(smartcalc, sampler_1) {
+  s21::Sampler sampler{testSampler("x*2+1", {-10.0, 10.0, -25.0, 25.0, 0.01})};
+
+  EXPECT_EQ(sampler.evaluations(), 257U);
+  EXPECT_EQ(sampler.x().front(), -10.0);
+  EXPECT_EQ(sampler.x().back(), 10.0);
+
+  for (double y : sampler.y()) EXPECT_FALSE(std::isnan(y));
+}
+
+TEST(smartcalc, sampler_2) {
+  s21::Sampler sampler{testSampler("sin(x)", {-10.0, 10.0, -2.0, 2.0, 0.01})};
+  const std::vector<double> &x{sampler.x()}, &y{sampler.y()};
+
+  EXPECT_LT(sampler.evaluations(), 2001U);
+
+  for (std::size_t i{1}; i < x.size(); ++i) {
+    double middle{(x[i - 1] + x[i]) / 2};
+    EXPECT_NEAR((y[i - 1] + y[i]) / 2, std::sin(middle), 4e-3);
+  }
+}
+
+TEST(smartcalc, sampler_3) {
+  s21::Sampler sampler{testSampler("tan(x)", {-3.0, 3.0, -25.0, 25.0, 0.01})};
+  const std::vector<double> &x{sampler.x()}, &y{sampler.y()};
+  std::size_t breaks{};
+
+  for (std::size_t i{}; i < x.size(); ++i) {
+    if (std::isnan(y[i])) {
+      ++breaks;
+      EXPECT_NEAR(std::fabs(x[i]), 1.5707963, 0.01);
+    }
+  }
+
+  EXPECT_EQ(breaks, 2U);
+  EXPECT_LT(sampler.evaluations(), 601U);
+}
+
+TEST(smartcalc, sampler_4) {
+  s21::Sampler sampler{testSampler("sqrt(x)", {-5.0, 5.0, -5.0, 5.0, 0.001})};
+  const std::vector<double> &x{sampler.x()}, &y{sampler.y()};
+  std::size_t first{};
+
+  while (std::isnan(y[first])) ++first;
+
+  EXPECT_NEAR(x[first], 0.0, 0.002);
+  EXPECT_LT(sampler.evaluations(), 10001U);
+}
+
+TEST(smartcalc, sampler_5) {
+  s21::Sampler sampler{{-10.0, 10.0, -25.0, 25.0, 0.01}};
+  std::size_t calls{};
+  s21::Sampler::Evaluator evaluate{
+      [&calls](const double *xs, double *out, std::size_t n) {
+        std::copy(xs, xs + n, out);
+        ++calls;
+      }};
+
+  EXPECT_FALSE(sampler.refine(evaluate, [] { return true; }));
+  EXPECT_EQ(calls, 0U);
+  EXPECT_EQ(sampler.evaluations(), 0U);
+  EXPECT_TRUE(sampler.x().empty());
+
+  EXPECT_TRUE(sampler.refine(evaluate, [] { return false; }));
+  EXPECT_EQ(calls, 1U);
+  EXPECT_EQ(sampler.evaluations(), 257U);
+}
+
+TEST(smartcalc, segments_1) {
+  EXPECT_EQ(s21::SegmentCache::level(20.0, 640), -5);
+  EXPECT_EQ(s21::SegmentCache::level(1024.0, 512), 1);
+  EXPECT_EQ(s21::SegmentCache::resolution(-5), 0.03125);
+  EXPECT_EQ(s21::SegmentCache::chunkWidth(-5), 8.0);
+}
+
+TEST(smartcalc, segments_2) {
+  s21::SegmentCache cache;
+  std::vector<double> x, y;
+
+  EXPECT_EQ(cache.missing(-5, -10.0, 10.0),
+            (std::vector<long long>{-2, -1, 0, 1}));
+
+  cache.insert(-5, -1, {{-8.0, 0.0}, {1.0, 2.0}});
+  cache.insert(-5, 0, {{0.0, 8.0}, {2.0, 3.0}});
+
+  EXPECT_EQ(cache.missing(-5, -10.0, 10.0), (std::vector<long long>{-2, 1}));
+  EXPECT_TRUE(cache.missing(-5, -7.0, 7.0).empty());
+  EXPECT_EQ(cache.missing(-4, -7.0, 7.0).size(), 2U);
+
+  cache.collect(-5, -10.0, 10.0, x, y);
+  EXPECT_EQ(x, (std::vector<double>{-16.0, -8.0, 0.0, 0.0, 8.0, 8.0}));
+  EXPECT_TRUE(std::isnan(y.front()));
+  EXPECT_TRUE(std::isnan(y.back()));
+  EXPECT_EQ(y[2], 2.0);
+}
+
+TEST(smartcalc, segments_3) {
+  s21::SegmentCache cache{2};
+
+  cache.insert(-5, 0, {});
+  cache.insert(-4, 0, {});
+  cache.insert(-4, 1, {});
+
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(cache.missing(-5, 0.0, 1.0).size(), 1U);
+  EXPECT_TRUE(cache.missing(-4, 0.0, 20.0).empty());
+}
+
+TEST(smartcalc, segments_4) {
+  s21::SegmentCache cache;
+  std::vector<double> x, y;
+
+  int level{s21::SegmentCache::level(2.0e300, 640)};
+
+  EXPECT_LE(cache.missing(level, -1.0e300, 1.0e300).size(), 4U);
+  EXPECT_EQ(cache.missing(0, -1.0e300, 1.0e300).size(), 256U);
+  EXPECT_EQ(cache.missing(-1000, 1.0e6, 2.0e6).size(), 1U);
+  EXPECT_TRUE(cache.missing(0, std::nan(""), 1.0).empty());
+  EXPECT_TRUE(cache.missing(0, 1.0, -1.0).empty());
+
+  cache.collect(0, -1.0e300, 1.0e300, x, y);
+  EXPECT_EQ(x.size(), 256U);
+}
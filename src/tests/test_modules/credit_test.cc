@@ -537,3 +537,191 @@ TEST(credit, differentiated_50) {
   Data data{2000000, 73, MONTHS, 22.222, DIF, Date{22, 2, 2222}};
   testCredit(data, {3368737.81, 2000000, 1368737.81});
 }
+
+TEST(credit, day_count_1) {
+  Data data{1200, 12, MONTHS, 12, DIF, Date{15, 1, 2023}};
+  data.day_count = s21::DayCount::THIRTY_360;
+  testCredit(data, {1278, 1200, 78});
+}
+
+TEST(credit, day_count_2) {
+  s21::CreditModel credit;
+
+  credit.addData(Data{1200, 12, MONTHS, 12, DIF, Date{15, 1, 2023}});
+  credit.setDayCount(s21::DayCount::THIRTY_360);
+  EXPECT_NEAR(credit.calculateTotals().interest, 78, 1e-9);
+
+  credit.setDayCount(s21::DayCount::ACT_360);
+  EXPECT_GT(credit.calculateTotals().interest, 78);
+}
+
+TEST(credit, holidays_1) {
+  s21::CreditModel credit;
+  s21::HolidayCalendar holidays;
+
+  credit.addData(Data{1200, 12, MONTHS, 12, DIF, Date{15, 1, 2023}});
+  credit.setHolidays(&holidays);
+  credit.calculatePayments();
+  EXPECT_EQ(credit.schedule().dates.front(), Date(15, 2, 2023));
+  EXPECT_EQ(credit.schedule().dates[5], Date(17, 7, 2023));
+
+  credit.clear();
+  credit.setHolidays(nullptr);
+  credit.calculatePayments();
+  EXPECT_EQ(credit.schedule().dates[5], Date(15, 7, 2023));
+}
+
+TEST(credit, schedule_1) {
+  s21::CreditModel credit;
+
+  credit.addData(Data{1000, 4, MONTHS, 5, ANN, Date{6, 7, 2021}});
+  credit.calculatePayments();
+
+  const s21::CreditModel::Schedule &schedule{credit.schedule()};
+  std::vector<std::vector<std::string>> table{credit.table()};
+
+  ASSERT_FALSE(schedule.dates.empty());
+  ASSERT_EQ(table.size(), schedule.size());
+  EXPECT_EQ(schedule.dates.front(), Date(6, 8, 2021));
+  EXPECT_EQ(table.front()[0], "06.08.2021");
+  EXPECT_EQ(schedule.balance.back(), 0.0L);
+
+  for (std::size_t i{}; i < schedule.size(); ++i) {
+    EXPECT_EQ(table[i][1], s21::CreditModel::toStr(schedule.percent[i]));
+    EXPECT_EQ(table[i][3], s21::CreditModel::toStr(schedule.summary[i]));
+  }
+
+  EXPECT_EQ(credit.totalTable()[0], "Interest paid\n10.57");
+
+  credit.clear();
+  EXPECT_EQ(credit.schedule().size(), 0U);
+}
+
+TEST(credit, portfolio_1) {
+  s21::CreditPortfolio portfolio{3};
+  s21::CreditPortfolio::Loans loans;
+
+  for (std::size_t i{}; i < 200; ++i) {
+    loans.add(1000.0L + i * 17, 1 + i % 60, 3.0L + i % 11, (i % 2) ? ANN : DIF,
+              Date::fromSerial(static_cast<Date::DaySerial>(18000 + i * 29)));
+  }
+
+  s21::CreditPortfolio::Totals totals{portfolio.totals(loans)};
+  std::vector<s21::CreditPortfolio::Schedule> schedules{
+      portfolio.schedules(loans)};
+
+  ASSERT_EQ(totals.interest.size(), loans.size());
+  ASSERT_EQ(schedules.size(), loans.size());
+
+  for (std::size_t i{}; i < loans.size(); ++i) {
+    s21::CreditModel credit;
+
+    credit.addData(loans.data(i));
+    credit.calculatePayments();
+
+    EXPECT_EQ(credit.schedule().balance, schedules[i].balance);
+    EXPECT_EQ(credit.schedule().dates, schedules[i].dates);
+    EXPECT_EQ(credit.totalTable()[0],
+              "Interest paid\n" + s21::CreditModel::toStr(totals.interest[i]));
+    EXPECT_NEAR(totals.total[i], loans.amount[i] + totals.interest[i], 1e-9);
+  }
+
+  EXPECT_TRUE(portfolio.totals(s21::CreditPortfolio::Loans{}).total.empty());
+}
+
+TEST(credit, totals_1) {
+  s21::CreditModel full, summary;
+  Data data{26744.12, 15, MONTHS, 16.111, ANN, Date{12, 3, 2005}};
+
+  full.addData(data);
+  summary.addData(data);
+  full.calculatePayments();
+
+  s21::CreditModel::Totals totals{summary.calculateTotals()};
+
+  EXPECT_TRUE(summary.schedule().dates.empty());
+  EXPECT_EQ(summary.totalTable(), full.totalTable());
+  EXPECT_NEAR(totals.interest, 2975.21, 1e-9);
+  EXPECT_NEAR(totals.total, 29719.33, 1e-9);
+  EXPECT_EQ(totals.debt, data.amount);
+
+  summary.calculatePayments();
+  EXPECT_EQ(summary.schedule().size(), full.schedule().size());
+}
+
+TEST(credit, quote_1) {
+  s21::CreditModel credit;
+  Data data{1200, 12, MONTHS, 12, DIF, Date{15, 1, 2023}};
+  data.day_count = s21::DayCount::THIRTY_360;
+
+  credit.addData(data);
+  EXPECT_NEAR(credit.quote().interest, 78, 1e-9);
+  EXPECT_NEAR(credit.quote().total, 1278, 1e-9);
+  EXPECT_NEAR(credit.calculateTotals().interest, 78, 1e-9);
+}
+
+TEST(credit, quote_2) {
+  for (std::size_t term{1}; term < 360; term += 7) {
+    s21::CreditModel credit;
+    Data data{250000, static_cast<long double>(term), MONTHS, 7.9, ANN,
+              Date{10, 2, 2024}};
+    data.day_count = s21::DayCount::THIRTY_360;
+
+    credit.addData(data);
+
+    s21::CreditModel::Totals quote{credit.quote()};
+    s21::CreditModel::Totals totals{credit.calculateTotals()};
+
+    EXPECT_NEAR(quote.interest, totals.interest, 0.02 * term);
+    EXPECT_NEAR(quote.total, totals.total, 0.02 * term);
+  }
+}
+
+TEST(credit, quote_3) {
+  s21::CreditModel credit;
+
+  credit.addData(Data{1000, 4, MONTHS, 0, ANN, Date{6, 7, 2021}});
+  EXPECT_EQ(credit.quote().interest, 0.0L);
+  EXPECT_EQ(credit.quote().total, 1000.0L);
+}
+
+TEST(credit, stream_1) {
+  s21::CreditModel full, stream;
+  Data data{9862.12, 7, MONTHS, 13.77, DIF, Date{9, 9, 2000}};
+  s21::CreditModel::Schedule rows;
+
+  full.addData(data);
+  stream.addData(data);
+  full.calculatePayments();
+
+  s21::CreditModel::Totals totals{
+      stream.streamPayments([&rows](const s21::CreditModel::Month &month) {
+        rows.push_back(month);
+      })};
+
+  EXPECT_TRUE(stream.schedule().dates.empty());
+  EXPECT_EQ(rows.dates, full.schedule().dates);
+  EXPECT_EQ(rows.percent, full.schedule().percent);
+  EXPECT_EQ(rows.balance, full.schedule().balance);
+  EXPECT_EQ(totals.interest, full.totals().interest);
+}
+
+TEST(credit, stream_2) {
+  s21::CreditModel full, credit;
+  Data data{9862.12, 7, MONTHS, 13.77, DIF, Date{9, 9, 2000}};
+  std::size_t rows{};
+  s21::CreditModel::RowCallback sink{[&rows](const s21::CreditModel::Month &) {
+    if (++rows == 3) throw std::runtime_error("sink");
+  }};
+
+  full.addData(data);
+  credit.addData(data);
+  full.calculatePayments();
+
+  EXPECT_THROW(credit.streamPayments(sink), std::runtime_error);
+  EXPECT_EQ(rows, 3U);
+
+  credit.calculatePayments();
+  EXPECT_EQ(credit.schedule().dates, full.schedule().dates);
+  EXPECT_EQ(credit.schedule().balance, full.schedule().balance);
+}
@@ -0,0 +1,367 @@
+/**
+ * @file date_test.cc
+ * @author kossadda (https://github.com/kossadda)
+ * @brief Test module for Date class.
+ * @version 1.0
+ * @date 2024-10-08
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "tests/main_test.h"
+
+using Date = s21::Date;
+
+TEST(date, serial_1) {
+  EXPECT_EQ(Date(1, 1, 1970).serial(), 0);
+  EXPECT_EQ(Date(31, 12, 1969).serial(), -1);
+  EXPECT_EQ(Date(1, 3, 2000).serial(), 11017);
+  EXPECT_EQ(Date::fromSerial(11017), Date(1, 3, 2000));
+  EXPECT_EQ(Date::fromSerial(-25567), Date(1, 1, 1900));
+}
+
+TEST(date, packed_1) {
+  static_assert(sizeof(Date) == sizeof(std::uint32_t));
+  static_assert(std::is_trivially_copyable_v<Date>);
+  static_assert(Date(31, 12, 65535).year() == 65535);
+
+  Date date{31, 12, 2024};
+
+  EXPECT_EQ(date.day(), 31);
+  EXPECT_EQ(date.month(), 12);
+  EXPECT_EQ(date.year(), 2024);
+  EXPECT_LT(Date(31, 12, 2023), Date(1, 1, 2024));
+  EXPECT_LT(Date(30, 11, 2024), Date(1, 12, 2024));
+  EXPECT_GT(Date(2, 1, 2024), Date(1, 1, 2024));
+  EXPECT_LE(date, Date(31, 12, 2024));
+  EXPECT_GE(date, Date(31, 12, 2024));
+  EXPECT_NE(date, Date(30, 12, 2024));
+  EXPECT_THROW(Date(32, 1, 2024), std::invalid_argument);
+  EXPECT_THROW(Date(1, 16, 2024), std::invalid_argument);
+}
+
+TEST(date, packed_2) {
+  std::vector<Date> dates;
+
+  for (Date::DaySerial serial{20000}; serial > 0; serial -= 37) {
+    dates.push_back(Date::fromSerial(serial));
+  }
+
+  std::sort(dates.begin(), dates.end());
+
+  for (std::size_t i{1}; i < dates.size(); ++i) {
+    EXPECT_EQ(dates[i] - dates[i - 1], 37U);
+  }
+}
+
+TEST(date, parse_1) {
+  Date date;
+
+  EXPECT_EQ(Date::parse("29.02.2024", date), Date::ParseResult::PARSE_OK);
+  EXPECT_EQ(date, Date(29, 2, 2024));
+  EXPECT_EQ(Date::parse("2023-12-31", date), Date::ParseResult::PARSE_OK);
+  EXPECT_EQ(date, Date(31, 12, 2023));
+  EXPECT_EQ(Date::parse("29.02.2023", date),
+            Date::ParseResult::PARSE_BAD_DATE);
+  EXPECT_EQ(Date::parse("2023-00-10", date),
+            Date::ParseResult::PARSE_BAD_DATE);
+  EXPECT_EQ(Date::parse("1.1.2024", date),
+            Date::ParseResult::PARSE_BAD_FORMAT);
+  EXPECT_EQ(Date::parse("01/01/2024", date),
+            Date::ParseResult::PARSE_BAD_FORMAT);
+  EXPECT_EQ(Date::parse("0a.01.2024", date),
+            Date::ParseResult::PARSE_BAD_FORMAT);
+  EXPECT_EQ(Date::parse("", date), Date::ParseResult::PARSE_BAD_FORMAT);
+  EXPECT_EQ(date, Date(31, 12, 2023));
+}
+
+TEST(date, parse_2) {
+  std::vector<std::string_view> texts{"01.01.2024", "2024-02-30", "x",
+                                      "2024-03-15"};
+  std::vector<Date> dates;
+  std::vector<Date::ParseResult> results;
+
+  EXPECT_EQ(Date::parse(texts, dates, results), 2U);
+  ASSERT_EQ(dates.size(), texts.size());
+  EXPECT_EQ(dates[0], Date(1, 1, 2024));
+  EXPECT_EQ(dates[3], Date(15, 3, 2024));
+  EXPECT_EQ(results[1], Date::ParseResult::PARSE_BAD_DATE);
+  EXPECT_EQ(results[2], Date::ParseResult::PARSE_BAD_FORMAT);
+
+  for (Date::DaySerial serial{-25567}; serial < 84000; serial += 13) {
+    char buffer[Date::kFormatSize];
+    Date date{Date::fromSerial(serial)}, parsed;
+
+    date.format(buffer, buffer + Date::kFormatSize);
+    EXPECT_EQ(Date::parse({buffer, Date::kFormatSize - 1}, parsed),
+              Date::ParseResult::PARSE_OK);
+    EXPECT_EQ(parsed, date);
+  }
+}
+
+TEST(date, day_count_1) {
+  Date begin{1, 7, 2023}, end{1, 7, 2024};
+
+  EXPECT_DOUBLE_EQ(s21::ActActIsda::yearFraction(begin, end),
+                   183.0L / 365 + 183.0L / 366);
+  EXPECT_DOUBLE_EQ(s21::Act365Fixed::yearFraction(begin, end), 366.0L / 365);
+  EXPECT_DOUBLE_EQ(s21::Act360::yearFraction(begin, end), 366.0L / 360);
+  EXPECT_DOUBLE_EQ(s21::Thirty360::yearFraction(begin, end), 1.0L);
+  EXPECT_DOUBLE_EQ(
+      s21::Thirty360::yearFraction(Date(31, 1, 2024), Date(29, 2, 2024)),
+      29.0L / 360);
+  EXPECT_DOUBLE_EQ(
+      s21::Thirty360::yearFraction(Date(30, 1, 2024), Date(31, 3, 2024)),
+      60.0L / 360);
+  EXPECT_DOUBLE_EQ(
+      s21::Thirty360::yearFraction(Date(15, 1, 2024), Date(31, 1, 2024)),
+      16.0L / 360);
+  EXPECT_DOUBLE_EQ(s21::yearFraction(s21::DayCount::ACT_360, begin, end),
+                   366.0L / 360);
+  EXPECT_DOUBLE_EQ(s21::yearFraction(s21::DayCount::ACT_ACT_ISDA, begin, end),
+                   s21::ActActIsda::yearFraction(begin, end));
+}
+
+TEST(date, range_1) {
+  s21::DateRange days{Date(30, 12, 2023), Date(2, 1, 2024)};
+  std::vector<Date> dates(days.begin(), days.end());
+
+  ASSERT_EQ(days.size(), 3U);
+  ASSERT_EQ(dates.size(), 3U);
+  EXPECT_EQ(dates[0], Date(30, 12, 2023));
+  EXPECT_EQ(dates[2], Date(1, 1, 2024));
+
+  s21::DateRange weeks{Date(1, 1, 2024), Date(1, 2, 2024), 7};
+  std::size_t count{};
+
+  for (Date date : weeks) {
+    EXPECT_EQ((date - Date(1, 1, 2024)) % 7, 0U);
+    ++count;
+  }
+
+  EXPECT_EQ(count, 5U);
+  EXPECT_EQ(weeks.size(), 5U);
+  EXPECT_EQ(s21::DateRange(Date(2, 1, 2024), Date(1, 1, 2024)).size(), 0U);
+}
+
+TEST(date, serial_2) {
+  Date date{1, 1, 1900};
+  Date::DaySerial serial{date.serial()};
+  Date::DateSize day{1}, month{1}, year{1900};
+
+  for (; year < 2201; ++serial) {
+    Date current{day, month, year};
+
+    EXPECT_EQ(current.serial(), serial);
+    EXPECT_EQ(Date::fromSerial(serial), current);
+    EXPECT_EQ(date, current);
+
+    date.addDays(1);
+
+    Date::DateSize days[]{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (Date::isYearLeap(year)) days[1] = 29;
+
+    if (++day > days[month - 1]) {
+      day = 1;
+
+      if (++month > Date::kYearMonths) {
+        month = 1;
+        ++year;
+      }
+    }
+  }
+}
+
+TEST(date, arithmetic_1) {
+  EXPECT_EQ(Date(1, 1, 2025) - Date(1, 1, 2024), 366U);
+  EXPECT_EQ(Date(15, 6, 2054) - Date(15, 6, 2024), 10957U);
+  EXPECT_EQ(Date(28, 2, 2024) + 1, Date(29, 2, 2024));
+  EXPECT_EQ(Date(31, 12, 2024) + 10957, Date(31, 12, 2054));
+  EXPECT_EQ(Date(29, 2, 2024).daysPassedInYear(), 60U);
+  EXPECT_EQ(Date(31, 12, 2023).daysPassedInYear(), 365U);
+  EXPECT_EQ(Date(31, 12, 2024).daysLeftInYear(), 0U);
+}
+
+TEST(date, arithmetic_2) {
+  EXPECT_EQ(Date(31, 1, 2024).addDepositMonth(1), Date(2, 3, 2024));
+  EXPECT_EQ(Date(15, 11, 2023).addDepositMonth(3), Date(15, 2, 2024));
+  EXPECT_EQ(Date(15, 12, 2023).addDepositMonth(26), Date(15, 2, 2026));
+  EXPECT_EQ(Date(31, 1, 2023).addCreditMonth(31), Date(28, 2, 2023));
+}
+
+TEST(date, constexpr_1) {
+  constexpr Date kBegin{1, 1, 2024};
+  constexpr Date kEnd{kBegin + 59};
+
+  static_assert(kEnd == Date(29, 2, 2024));
+  static_assert(kEnd.daysPassedInYear() == 60);
+  static_assert(kEnd - kBegin == 59);
+  static_assert(Date::isYearLeap(2000) && !Date::isYearLeap(2100));
+  static_assert(Date(31, 12, 2023) < kBegin);
+  static_assert(Date(15, 12, 2023).addDepositMonth(2) == Date(15, 2, 2024));
+
+  EXPECT_EQ(kEnd.currentDate(), "29.02.2024");
+}
+
+TEST(date, invalid_1) {
+  EXPECT_THROW(Date(29, 2, 2023), std::invalid_argument);
+  EXPECT_THROW(Date(1, 13, 2023), std::invalid_argument);
+  EXPECT_THROW(Date(0, 1, 2023), std::invalid_argument);
+  EXPECT_NO_THROW(Date(29, 2, 2024));
+}
+
+TEST(date, leap_days_1) {
+  Date begin{17, 5, 1996};
+
+  for (Date end{begin}; end.year() < 2060; end.addDays(97)) {
+    std::size_t leap{};
+
+    for (Date day{begin}; day < end;) {
+      day.addDays(1);
+      leap += Date::isYearLeap(day.year());
+    }
+
+    auto days{begin.leapDaysBetween(end)};
+    EXPECT_EQ(days.second, leap);
+    EXPECT_EQ(days.first + days.second, end - begin);
+  }
+
+  static_assert(Date(1, 1, 2023).leapDaysBetween(Date(1, 1, 2025)) ==
+                std::pair<std::size_t, std::size_t>{365, 366});
+}
+
+TEST(date, format_1) {
+  char buffer[Date::kFormatSize];
+
+  char *end{Date(5, 3, 2024).format(buffer, buffer + 10)};
+  ASSERT_NE(end, nullptr);
+  EXPECT_EQ(std::string(buffer, end), "05.03.2024");
+  EXPECT_EQ(Date(5, 3, 2024).format(buffer, buffer + 9), nullptr);
+  EXPECT_EQ(Date(31, 12, 12345).currentDate(), "31.12.12345");
+  EXPECT_EQ(Date(1, 10, 987).currentDate(), "01.10.987");
+}
+
+TEST(date, calendar_1) {
+  for (Date::DaySerial serial{Date(1, 1, 1899).serial()};
+       serial < Date(1, 1, 2202).serial(); ++serial) {
+    EXPECT_EQ(s21::Calendar::toDate(serial), Date::fromSerial(serial));
+  }
+
+  EXPECT_EQ(s21::Calendar::monthStart(3, 2024), Date(1, 3, 2024).serial());
+  EXPECT_EQ(s21::Calendar::monthStart(3, 2500), Date(1, 3, 2500).serial());
+  EXPECT_EQ(s21::Calendar::addMonths(Date(31, 1, 2024), 1, 31),
+            Date(29, 2, 2024));
+}
+
+TEST(date, calendar_2) {
+  Date start{31, 8, 2023};
+  Date date{start};
+  std::pmr::vector<Date> dates;
+
+  s21::Calendar::creditSchedule(start, 10, dates);
+  s21::Calendar::creditSchedule(start, 500, dates);
+
+  ASSERT_EQ(dates.size(), 510U);
+
+  for (const Date &payment : dates) {
+    EXPECT_EQ(payment, date.addCreditMonth(31));
+  }
+}
+
+TEST(date, calendar_3) {
+  Date start{31, 1, 2020};
+  Date last{start + 2000};
+
+  for (std::size_t months : {1, 3, 6, 12}) {
+    std::pmr::vector<Date> dates{
+        s21::Calendar::depositSchedule(start, last, 0, months)};
+    Date date{start};
+
+    for (const Date &payment : dates) {
+      date.addDepositMonth(months);
+      EXPECT_EQ(payment, (date > last) ? last : date);
+    }
+
+    EXPECT_EQ(dates.back(), last);
+  }
+
+  EXPECT_EQ(s21::Calendar::depositSchedule(start, last, 7, 0).size(), 286U);
+  EXPECT_EQ(s21::Calendar::depositSchedule(start, last, 0, 0).size(), 1U);
+  EXPECT_TRUE(s21::Calendar::depositSchedule(start, start, 1, 0).empty());
+}
+
+TEST(date, calendar_4) {
+  alignas(std::max_align_t) std::byte buffer[2048];
+  Date start{15, 3, 2021};
+
+  for (auto [days, months, last] :
+       {std::tuple{0, 1, Date(15, 3, 2051)}, {1, 0, start + 500}}) {
+    std::pmr::monotonic_buffer_resource arena{
+        buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+    EXPECT_NO_THROW(s21::Calendar::depositSchedule(start, last, days, months,
+                                                   nullptr, &arena));
+  }
+}
+
+TEST(date, holidays_1) {
+  s21::HolidayCalendar holidays;
+
+  EXPECT_TRUE(holidays.isBusinessDay(Date(1, 1, 1970)));
+  EXPECT_FALSE(holidays.isBusinessDay(Date(3, 1, 1970)));
+  EXPECT_FALSE(holidays.isBusinessDay(Date(5, 10, 2024)));
+  EXPECT_FALSE(holidays.isBusinessDay(Date(6, 10, 2024)));
+  EXPECT_FALSE(holidays.isBusinessDay(Date(6, 10, 2424)));
+  EXPECT_EQ(holidays.nextBusinessDay(Date(5, 10, 2024)), Date(7, 10, 2024));
+  EXPECT_EQ(holidays.nextBusinessDay(Date(7, 10, 2024)), Date(7, 10, 2024));
+  EXPECT_EQ(holidays.nextBusinessDay(Date(31, 12, 2200)), Date(31, 12, 2200));
+  EXPECT_EQ(holidays.nextBusinessDay(Date(31, 12, 2044)), Date(2, 1, 2045));
+
+  for (Date::DateSize day{1}; day < 9; ++day) {
+    holidays.addHoliday(Date(day, 1, 2024));
+  }
+
+  EXPECT_EQ(holidays.nextBusinessDay(Date(30, 12, 2023)), Date(9, 1, 2024));
+
+  holidays.clear();
+  EXPECT_EQ(holidays.nextBusinessDay(Date(30, 12, 2023)), Date(1, 1, 2024));
+}
+
+TEST(date, holidays_2) {
+  s21::HolidayCalendar holidays;
+  std::string path{::testing::TempDir() + "holidays.txt"};
+
+  std::ofstream{path} << "# New year\n01.01.2025\n  02.01.2025\n\n08.03.2025\n";
+  holidays.load(path);
+
+  EXPECT_FALSE(holidays.isBusinessDay(Date(1, 1, 2025)));
+  EXPECT_FALSE(holidays.isBusinessDay(Date(2, 1, 2025)));
+  EXPECT_TRUE(holidays.isBusinessDay(Date(3, 1, 2025)));
+
+  std::ofstream{path} << "01.13.2025\n";
+  EXPECT_THROW(holidays.load(path), std::invalid_argument);
+  std::ofstream{path} << "01-01-2025\n";
+  EXPECT_THROW(holidays.load(path), std::invalid_argument);
+  EXPECT_THROW(holidays.load(path + ".missing"), std::invalid_argument);
+}
+
+TEST(date, holidays_3) {
+  s21::HolidayCalendar holidays;
+  Date start{31, 8, 2024};
+  std::pmr::vector<Date> dates;
+
+  s21::Calendar::creditSchedule(start, 12, dates, &holidays);
+
+  EXPECT_EQ(dates[0], Date(30, 9, 2024));
+  EXPECT_EQ(dates[1], Date(31, 10, 2024));
+  EXPECT_EQ(dates[2], Date(2, 12, 2024));
+  EXPECT_EQ(dates[3], Date(31, 12, 2024));
+
+  dates = s21::Calendar::depositSchedule(Date(1, 10, 2024), Date(1, 11, 2024),
+                                         1, 0, &holidays);
+
+  EXPECT_EQ(dates.size(), 23U);
+
+  for (const Date &date : dates) EXPECT_TRUE(holidays.isBusinessDay(date));
+}
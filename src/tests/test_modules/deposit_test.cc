@@ -1751,3 +1751,139 @@ TEST(deposit, combinated_5) {
             &ops};
   testDeposit(data, {39244887.07, 37877008.19});
 }
+
+TEST(deposit, totals_1) {
+  std::vector<Op> ops{Op{5000, OpType::REFILL, Date{3, 3, 2021}},
+                      Op{2000, OpType::WITHDRAWAL, Date{9, 9, 2022}}};
+  s21::DepositModel full, summary;
+
+  full.addData(Data{3000000, 30, MONTHS, 9.5, 16, Type::SECOND, Freq::MONTH,
+                    Date{15, 1, 2021}, &ops});
+  summary.addData(Data{3000000, 30, MONTHS, 9.5, 16, Type::SECOND,
+                       Freq::MONTH, Date{15, 1, 2021}, &ops});
+  full.calculatePayments();
+
+  s21::DepositModel::Totals totals{summary.calculateTotals()};
+
+  EXPECT_TRUE(summary.schedule().dates.empty());
+  EXPECT_TRUE(summary.taxTable().empty());
+  EXPECT_FALSE(full.taxTable().empty());
+  EXPECT_EQ(summary.totalTable(), full.totalTable());
+  EXPECT_GT(totals.tax, 0.0L);
+  EXPECT_EQ(totals.balance, full.schedule().balance.back());
+  EXPECT_EQ(totals.total, totals.balance);
+}
+
+TEST(deposit, stream_1) {
+  s21::DepositModel deposit;
+  std::size_t rows{};
+  Date last;
+
+  deposit.addData(Data{100000, 360, MONTHS, 7, 16, Type::SECOND, Freq::DAY,
+                       Date{1, 1, 2000}});
+
+  s21::DepositModel::Totals totals{
+      deposit.streamPayments([&rows, &last](const s21::DepositModel::Month &m) {
+        ++rows;
+        last = m.current;
+      })};
+
+  EXPECT_EQ(rows, Date(1, 1, 2030) - Date(1, 1, 2000));
+  EXPECT_EQ(last, Date(1, 1, 2030));
+  EXPECT_TRUE(deposit.schedule().dates.empty());
+  EXPECT_GT(totals.balance, 100000.0L);
+}
+
+TEST(deposit, data_1) {
+  Data data{10000, 12, MONTHS, 15, 16, Type::SECOND, Freq::DAY,
+            Date{1, 1, 2020}};
+  s21::DepositModel first, second;
+
+  first.addData(data);
+  second.addData(data);
+  EXPECT_EQ(data.base.rate, 15.0L);
+
+  for (std::size_t i{}; i < 3; ++i) {
+    second.clear();
+    second.addData(data);
+    second.calculatePayments();
+  }
+
+  first.calculatePayments();
+  EXPECT_EQ(first.schedule().balance, second.schedule().balance);
+  EXPECT_EQ(first.totalTable(), second.totalTable());
+  EXPECT_NEAR(first.schedule().balance.back(), 11617.99, 1e-9);
+}
+
+TEST(deposit, rerun_1) {
+  std::vector<Op> ops{Op{50000, OpType::REFILL, Date{3, 3, 2021}},
+                      Op{20000, OpType::WITHDRAWAL, Date{9, 9, 2022}},
+                      Op{10000, OpType::REFILL, Date{1, 1, 2020}}};
+  Data data{3000000, 30, MONTHS, 9.5, 16, Type::FIRST, Freq::MONTH,
+            Date{15, 1, 2021}, &ops};
+  s21::DepositModel single, rerun;
+
+  single.addData(data);
+  rerun.addData(data);
+  single.calculatePayments();
+
+  s21::DepositModel::Totals totals{rerun.calculateTotals()};
+
+  rerun.calculatePayments();
+
+  EXPECT_EQ(totals.interest, single.totals().interest);
+  EXPECT_EQ(totals.tax, single.totals().tax);
+  EXPECT_EQ(rerun.totalTable(), single.totalTable());
+  EXPECT_EQ(rerun.table(), single.table());
+  EXPECT_EQ(rerun.taxTable(), single.taxTable());
+  EXPECT_EQ(rerun.schedule().size(), 32U);
+}
+
+TEST(deposit, stream_2) {
+  std::vector<Op> ops{Op{50000, OpType::REFILL, Date{3, 3, 2021}},
+                      Op{20000, OpType::WITHDRAWAL, Date{9, 9, 2022}}};
+  s21::DepositModel deposit;
+  std::size_t rows[2]{};
+  s21::DepositModel::Totals totals[2];
+
+  deposit.addData(Data{3000000, 30, MONTHS, 9.5, 16, Type::SECOND,
+                       Freq::MONTH, Date{15, 1, 2021}, &ops});
+
+  for (std::size_t i{}; i < 2; ++i) {
+    totals[i] = deposit.streamPayments(
+        [&rows, i](const s21::DepositModel::Month &) { ++rows[i]; });
+  }
+
+  EXPECT_EQ(rows[0], 32U);
+  EXPECT_EQ(rows[1], rows[0]);
+  EXPECT_EQ(totals[1].interest, totals[0].interest);
+  EXPECT_EQ(totals[1].tax, totals[0].tax);
+  EXPECT_EQ(totals[1].balance, totals[0].balance);
+  EXPECT_EQ(totals[1].effective_rate, totals[0].effective_rate);
+}
+
+TEST(deposit, operations_1) {
+  std::vector<Op> sorted, reversed;
+
+  for (Date::DaySerial serial{18000}; serial < 19000; serial += 3) {
+    sorted.push_back(Op{100, OpType::REFILL, Date::fromSerial(serial)});
+    sorted.push_back(Op{50, OpType::WITHDRAWAL, Date::fromSerial(serial)});
+  }
+
+  for (std::size_t i{sorted.size()}; i > 0; i -= 2) {
+    reversed.push_back(sorted[i - 2]);
+    reversed.push_back(sorted[i - 1]);
+  }
+
+  s21::DepositModel first, second;
+
+  first.addData(Data{100000, 36, MONTHS, 8, 16, Type::SECOND, Freq::MONTH,
+                     Date{1, 1, 2019}, &sorted});
+  second.addData(Data{100000, 36, MONTHS, 8, 16, Type::SECOND, Freq::MONTH,
+                      Date{1, 1, 2019}, &reversed});
+  first.calculatePayments();
+  second.calculatePayments();
+
+  EXPECT_EQ(first.table(), second.table());
+  EXPECT_EQ(first.schedule().size(), 36U + 2 * 331);
+}
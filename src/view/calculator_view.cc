@@ -18,7 +18,10 @@ CalculatorView::CalculatorView(CalculatorController *controller) : QWidget{} {
   initView();
 }
 
-CalculatorView::~CalculatorView() { delete controller_; }
+CalculatorView::~CalculatorView() {
+  delete plot_;
+  delete controller_;
+}
 
 void CalculatorView::allocateMemory(CalculatorController *controller) {
   if (controller) {